@@ -1,12 +1,17 @@
 #pragma once
 
+#include "generator.hpp"
+#include "lane.hpp"
 #include "sortable.hpp"
 
-#include <cppcoro/generator.hpp>
-
+#include <algorithm>
+#include <cstdint>
 #include <exception>
 #include <memory>
+#include <span>
 #include <stack>
+#include <utility>
+#include <vector>
 
 namespace sortvis
 {
@@ -14,7 +19,13 @@ namespace sortvis
  * @brief Function Signature for Algorithms
  *
  */
-using SorterAlgorithm = cppcoro::generator<const int> (*)(std::shared_ptr<sortvis::SortableCollection>);
+using SorterAlgorithm = sortvis::Generator<const int> (*)(std::shared_ptr<sortvis::SortableCollection>);
+
+/**
+ * @brief Function Signature for uninstrumented Algorithms sorting in place
+ *
+ */
+using NativeAlgorithm = void (*)(std::span<int>);
 
 /**
  * @brief Thrown if an initialization exception occurred
@@ -24,6 +35,152 @@ class InitFailureException : public std::exception
 {
 	using std::exception::exception;
 };
+
+/**
+ * @brief plain in place access to ints with the interface of SortableCollection the algorithms use,
+ * comparisons & swaps are not counted and states are ignored
+ *
+ */
+class NativeData
+{
+private:
+	int* first;
+	size_t count;
+	std::vector<std::vector<int>>* aux; //! shared by all copies like the collection of the instrumented policy
+
+	[[nodiscard]] int* buffer(size_t idx) noexcept
+	{
+		return idx == sortvis::SortableCollection::MAIN_BUFFER ? first : (*aux)[idx - 1].data();
+	}
+
+public:
+	/**
+	 * @brief Construct a new Native Data object
+	 *
+	 * @param data ints to sort in place
+	 * @param buffers storage of the aux arrays, must outlive all copies
+	 */
+	NativeData(std::span<int> data, std::vector<std::vector<int>>& buffers) :
+	    first{data.data()}, count{data.size()}, aux{&buffers}
+	{
+	}
+
+	/**
+	 * @brief member access like the std::shared_ptr of the instrumented policy
+	 *
+	 */
+	[[nodiscard]] NativeData* operator->() noexcept
+	{
+		return this;
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return count;
+	}
+
+	[[nodiscard]] bool less(size_t lhs, size_t rhs) const noexcept
+	{
+		return first[lhs] < first[rhs];
+	}
+
+	[[nodiscard]] bool greater(size_t lhs, size_t rhs) const noexcept
+	{
+		return first[lhs] > first[rhs];
+	}
+
+	void swap(size_t lhs, size_t rhs) const noexcept
+	{
+		std::swap(first[lhs], first[rhs]);
+	}
+
+	void compareExchange(std::span<const size_t> lhs, std::span<const size_t> rhs) const noexcept
+	{
+		for(size_t k = 0; k < lhs.size(); ++k)
+		{
+			const int low = std::min(first[lhs[k]], first[rhs[k]]);
+			first[rhs[k]] = std::max(first[lhs[k]], first[rhs[k]]);
+			first[lhs[k]] = low;
+		}
+	}
+
+	size_t allocate(size_t elements)
+	{
+		aux->emplace_back(elements, 0);
+		return aux->size();
+	}
+
+	void release(size_t) noexcept
+	{
+		aux->pop_back();
+	}
+
+	[[nodiscard]] int read(size_t idx) const noexcept
+	{
+		return first[idx];
+	}
+
+	[[nodiscard]] int read(size_t buf, size_t idx) noexcept
+	{
+		return buffer(buf)[idx];
+	}
+
+	void write(size_t idx, int value) const noexcept
+	{
+		first[idx] = value;
+	}
+
+	void write(size_t buf, size_t idx, int value) noexcept
+	{
+		buffer(buf)[idx] = value;
+	}
+
+	template<typename STATE, typename... IDX>
+	void state(STATE, IDX...) const noexcept
+	{
+	}
+
+	void bufferState(size_t, sortvis::Sortable::AccessState, size_t) const noexcept
+	{
+	}
+};
+
+/**
+ * @brief compile time selection of how algorithms access their data and suspend
+ *
+ */
+namespace policies
+{
+/**
+ * @brief counts & marks every access on a SortableCollection and suspends after each of them
+ *
+ */
+struct Instrumented
+{
+	using Data = std::shared_ptr<sortvis::SortableCollection>;
+	using Generator = sortvis::Generator<const int>;
+};
+
+/**
+ * @brief sorts plain ints in place, the algorithms are plain functions that call nested ones directly
+ *
+ */
+struct Native
+{
+	using Data = sortvis::NativeData;
+	using Generator = void;
+};
+
+/**
+ * @brief counts & marks every access through one Lane of a parallel algorithm and suspends after each of them
+ *
+ */
+struct Worker
+{
+	using Data = sortvis::Lane*;
+	using Generator = sortvis::Generator<const int>;
+};
+} // namespace policies
 } // namespace sortvis
 
 /**
@@ -36,17 +193,267 @@ constexpr int INIT_MAGIC_VALUE = 0b10101010101010101010101010100001;
 constexpr int COMP_MAGIC_VALUE = 0b10101010101010101010101010100010;
 constexpr int SWAP_MAGIC_VALUE = 0b10101010101010101010101010100100;
 
-cppcoro::generator<const int> bubble(std::shared_ptr<sortvis::SortableCollection> data);
+sortvis::Generator<const int> bubble(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief quick sort with the last element as pivot & Lomuto partitions, quadratic on sorted input
+ *
+ */
+sortvis::Generator<const int> quick(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief quick sort with median of three pivots & Hoare partitions
+ *
+ */
+sortvis::Generator<const int> hoareQuick(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief quick sort with ninther pivots & three-way partitions, runs of equal elements are finished in one pass
+ *
+ */
+sortvis::Generator<const int> threeWayQuick(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief quick sort with random pivots & Hoare partitions, the pivots only depend on the number of elements
+ *
+ */
+sortvis::Generator<const int> randomQuick(std::shared_ptr<sortvis::SortableCollection> data);
+
+sortvis::Generator<const int> heap(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief shell sort with gaps of the extended Ciura sequence
+ *
+ */
+sortvis::Generator<const int> shell(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief shell sort with gaps of the Tokuda sequence
+ *
+ */
+sortvis::Generator<const int> tokudaShell(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief shell sort with gaps of the Sedgewick sequence, O(n^4/3) in the worst case
+ *
+ */
+sortvis::Generator<const int> sedgewickShell(std::shared_ptr<sortvis::SortableCollection> data);
+
+sortvis::Generator<const int> insertion(std::shared_ptr<sortvis::SortableCollection> data);
+
+sortvis::Generator<const int> selection(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief sorts blocks of 64 elements with bitonic networks, each step is one vector compare-exchange
+ * of up to 8 pairs, then merges the blocks through an aux array of n elements
+ *
+ */
+sortvis::Generator<const int> bitonic(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief least significant digit first radix sort of 8 bit digits through an aux array,
+ * digits that are equal for all elements are skipped
+ *
+ */
+sortvis::Generator<const int> lsdRadix(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief most significant digit first radix sort of 8 bit digits, each bucket is distributed into an aux array
+ * and copied back before its buckets are sorted by the next digit, small buckets are insertion sorted
+ *
+ */
+sortvis::Generator<const int> msdRadix(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief recursive merge sort, each merge copies the lower half into an aux array of len / 2 elements
+ * and merges it back with the upper half
+ *
+ */
+sortvis::Generator<const int> topDownMerge(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief iterative merge sort of doubling run widths, each pass merges all runs into the other one
+ * of the elements & an aux array of len elements
+ *
+ */
+sortvis::Generator<const int> bottomUpMerge(std::shared_ptr<sortvis::SortableCollection> data);
 
-cppcoro::generator<const int> quick(std::shared_ptr<sortvis::SortableCollection> data);
+/**
+ * @brief merge sort of the runs already present, descending runs are reversed first,
+ * then pairs of runs are merged like bottomUpMerge, sorted input allocates no aux array
+ *
+ */
+sortvis::Generator<const int> naturalMerge(std::shared_ptr<sortvis::SortableCollection> data);
 
-cppcoro::generator<const int> heap(std::shared_ptr<sortvis::SortableCollection> data);
+/**
+ * @brief quick sort with median of three pivots that falls back to heap sort after 2 log2(n) partition levels,
+ * ranges of up to 16 elements are insertion sorted
+ *
+ */
+sortvis::Generator<const int> intro(std::shared_ptr<sortvis::SortableCollection> data);
 
-cppcoro::generator<const int> shell(std::shared_ptr<sortvis::SortableCollection> data);
+/**
+ * @brief pattern defeating quick sort (Peters), intro sort that also detects already partitioned ranges,
+ * groups elements equal to an earlier pivot & swaps elements around after unbalanced partitions
+ *
+ */
+sortvis::Generator<const int> pdq(std::shared_ptr<sortvis::SortableCollection> data);
 
-cppcoro::generator<const int> insertion(std::shared_ptr<sortvis::SortableCollection> data);
+/**
+ * @brief TimSort (Peters), natural runs extended to a minimum length by binary insertion are merged
+ * through an aux array of the shorter run, long stretches from one run are found by galloping
+ *
+ */
+sortvis::Generator<const int> tim(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief merge sort on parallelLanes() worker threads, each lane sorts a chunk,
+ * then pairs of runs are merged in place by half as many lanes per round
+ *
+ */
+sortvis::Generator<const int> parallelMerge(std::shared_ptr<sortvis::SortableCollection> data);
 
-cppcoro::generator<const int> selection(std::shared_ptr<sortvis::SortableCollection> data);
+/**
+ * @brief sample sort on parallelLanes() worker threads, splitters drawn from a sorted sample
+ * distribute the elements through a tree of parallel partitions into one bucket per lane
+ *
+ */
+sortvis::Generator<const int> parallelSample(std::shared_ptr<sortvis::SortableCollection> data);
+
+/**
+ * @brief sets the number of worker threads of parallel algorithms started from now on
+ *
+ * @param lanes number of threads, 0 for std::thread::hardware_concurrency()
+ */
+void setParallelLanes(size_t lanes) noexcept;
+
+/**
+ * @return size_t number of worker threads parallel algorithms start with, at least 1
+ */
+[[nodiscard]] size_t parallelLanes() noexcept;
+
+constexpr size_t DEFAULT_PARALLEL_BATCH = 64;
+
+/**
+ * @brief sets how many operations each worker thread of parallel algorithms started from now on
+ * takes per step, the threads synchronize once per step
+ *
+ * @param operations operations per thread & step, at least 1
+ */
+void setParallelBatch(size_t operations) noexcept;
+
+/**
+ * @return size_t operations each worker thread of parallel algorithms takes per step
+ */
+[[nodiscard]] size_t parallelBatch() noexcept;
+
+/**
+ * @brief selects the kernels of native::bitonic
+ *
+ * @param enabled true for AVX2 if the cpu supports it, false for the scalar fallback
+ */
+void setVectorKernels(bool enabled) noexcept;
+
+/**
+ * @return true if native::bitonic runs the AVX2 kernels
+ */
+[[nodiscard]] bool vectorKernels() noexcept;
+
+/**
+ * @brief pivot selection of the quick sorts, all of them take the smaller side of a partition first
+ * so at most log2(n) ranges wait on their stack
+ *
+ */
+enum class PivotStrategy : uint8_t
+{
+	Last,          //! the last element
+	MedianOfThree, //! median of the first, middle & last element
+	Ninther,       //! median of three medians of three for more than 128 elements, else MedianOfThree
+	Random         //! a random element
+};
+
+/**
+ * @brief partition schemes of the quick sorts
+ *
+ */
+enum class Partition : uint8_t
+{
+	Lomuto,  //! one index scans the range, equal elements all end up left of the pivot
+	Hoare,   //! two indices scan towards each other & stop at equal elements, which splits them evenly
+	ThreeWay //! Dutch national flag, elements equal to the pivot are excluded from both sides
+};
+
+/**
+ * @brief gap sequences of shell sort
+ *
+ */
+enum class ShellGaps : uint8_t
+{
+	Ciura,    //! 1, 4, 10, 23, 57, 132, 301, 701, then x 2.25
+	Tokuda,   //! ceil((9^k - 4^k) / (5 * 4^(k - 1))): 1, 4, 9, 20, 46, 103, ...
+	Sedgewick //! 1 & 4^k + 3 * 2^(k - 1) + 1: 1, 8, 23, 77, 281, ...
+};
+
+/**
+ * @brief the gaps of sequence a shell sort of elements passes through, gaps of elements or more are left out
+ *
+ * @param sequence ShellGaps to compute
+ * @param elements number of elements to sort
+ * @return std::vector<size_t> gaps in descending order, ends with 1
+ */
+[[nodiscard]] std::vector<size_t> shellGaps(sortvis::algorithms::ShellGaps sequence, size_t elements);
+
+/**
+ * @brief the same algorithms compiled with policies::Native as plain functions that never suspend
+ *
+ */
+namespace native
+{
+void bubble(std::span<int> data);
+
+void quick(std::span<int> data);
+
+void hoareQuick(std::span<int> data);
+
+void threeWayQuick(std::span<int> data);
+
+void randomQuick(std::span<int> data);
+
+void heap(std::span<int> data);
+
+void shell(std::span<int> data);
+
+void tokudaShell(std::span<int> data);
+
+void sedgewickShell(std::span<int> data);
+
+void insertion(std::span<int> data);
+
+void selection(std::span<int> data);
+
+/**
+ * @brief bitonic on AVX2 registers if vectorKernels(), the blocks are then merged with the AVX2 merge kernel,
+ * otherwise the scalar bitonic compiled for policies::Native
+ *
+ */
+void bitonic(std::span<int> data);
+
+void lsdRadix(std::span<int> data);
+
+void msdRadix(std::span<int> data);
+
+void topDownMerge(std::span<int> data);
+
+void bottomUpMerge(std::span<int> data);
+
+void naturalMerge(std::span<int> data);
+
+void intro(std::span<int> data);
+
+void pdq(std::span<int> data);
+
+void tim(std::span<int> data);
+} // namespace native
 } // namespace sortvis::algorithms
 
 namespace sortvis
@@ -56,4 +463,10 @@ namespace sortvis
  * @return const char* to name of algo
  */
 const char* getAlgorithmName(SorterAlgorithm algorithm);
+
+/**
+ * @param algorithm function pointer to algo
+ * @return NativeAlgorithm built from the same source or nullptr if unknown
+ */
+NativeAlgorithm getNativeAlgorithm(SorterAlgorithm algorithm);
 } // namespace sortvis
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace sortvis
+{
+/**
+ * @brief a single set associative cache level counting hits & misses of line accesses
+ *
+ */
+class CacheLevel
+{
+public:
+	/**
+	 * @brief which line of a full set is evicted on a miss
+	 *
+	 */
+	enum class Replacement : uint8_t
+	{
+		LRU,
+		FIFO,
+		Random
+	};
+
+	/**
+	 * @brief geometry of a CacheLevel, size in bytes
+	 *
+	 */
+	struct Config
+	{
+		const char* name = "";
+		size_t size = 0;
+		size_t associativity = 1;
+		Replacement replacement = Replacement::LRU;
+	};
+
+private:
+	static constexpr uint64_t EMPTY = 0;
+
+	Config config;
+	size_t sets;
+	std::vector<uint64_t> tags;   //! line + 1 per way, EMPTY if unused
+	std::vector<uint64_t> stamps; //! last use for LRU, insertion for FIFO
+	uint64_t clock = 0;
+	uint64_t random = 0x9E3779B97F4A7C15;
+	uint64_t hitCount = 0;
+	uint64_t missCount = 0;
+
+	/**
+	 * @return size_t way to evict in the set starting at first
+	 */
+	[[nodiscard]] size_t victim(size_t first) noexcept
+	{
+		const size_t ways = config.associativity;
+		for(size_t way = 0; way < ways; ++way)
+		{
+			if(tags[first + way] == EMPTY)
+			{
+				return way;
+			}
+		}
+		if(config.replacement == Replacement::Random)
+		{
+			random ^= random << 13;
+			random ^= random >> 7;
+			random ^= random << 17;
+			return random % ways;
+		}
+		const auto oldest = std::min_element(stamps.begin() + static_cast<std::ptrdiff_t>(first),
+		    stamps.begin() + static_cast<std::ptrdiff_t>(first + ways));
+		return static_cast<size_t>(oldest - (stamps.begin() + static_cast<std::ptrdiff_t>(first)));
+	}
+
+public:
+	/**
+	 * @brief Construct a new Cache Level object
+	 *
+	 * @param levelConfig geometry of this level
+	 * @param lineSize size of a cache line in bytes
+	 */
+	CacheLevel(const Config& levelConfig, size_t lineSize) :
+	    config{levelConfig},
+	    sets{std::max(levelConfig.size / (lineSize * std::max(levelConfig.associativity, size_t(1))), size_t(1))}
+	{
+		config.associativity = std::max(config.associativity, size_t(1));
+		tags.assign(sets * config.associativity, EMPTY);
+		stamps.assign(sets * config.associativity, 0);
+	}
+
+	/**
+	 * @brief looks up line and loads it on a miss
+	 *
+	 * @param line address / line size
+	 * @return true on a hit
+	 */
+	bool access(uint64_t line) noexcept
+	{
+		++clock;
+		const size_t first = line % sets * config.associativity;
+		for(size_t way = 0; way < config.associativity; ++way)
+		{
+			if(tags[first + way] == line + 1)
+			{
+				++hitCount;
+				if(config.replacement == Replacement::LRU)
+				{
+					stamps[first + way] = clock;
+				}
+				return true;
+			}
+		}
+		++missCount;
+		const size_t way = victim(first);
+		tags[first + way] = line + 1;
+		stamps[first + way] = clock;
+		return false;
+	}
+
+	/**
+	 * @brief empties the level and resets its counters
+	 *
+	 */
+	void reset() noexcept
+	{
+		std::fill(tags.begin(), tags.end(), EMPTY);
+		std::fill(stamps.begin(), stamps.end(), 0);
+		clock = 0;
+		hitCount = 0;
+		missCount = 0;
+	}
+
+	[[nodiscard]] const char* name() const noexcept
+	{
+		return config.name;
+	}
+
+	[[nodiscard]] uint64_t hits() const noexcept
+	{
+		return hitCount;
+	}
+
+	[[nodiscard]] uint64_t misses() const noexcept
+	{
+		return missCount;
+	}
+};
+
+/**
+ * @brief simulated cache hierarchy fed with the element accesses of a SortableCollection,
+ * an access goes through the levels in order until one hits, every level it missed loads the line
+ *
+ */
+class CacheSimulator
+{
+private:
+	size_t lineSize;
+	size_t elementSize;
+	std::vector<sortvis::CacheLevel> cacheLevels;
+
+public:
+	static constexpr size_t DEFAULT_LINE_SIZE = 64;
+
+	/**
+	 * @brief Construct a new Cache Simulator object
+	 *
+	 * @param line size of a cache line in bytes
+	 * @param levels geometry of each level, closest to the cpu first
+	 * @param element size of an element in bytes
+	 */
+	CacheSimulator(size_t line, std::initializer_list<sortvis::CacheLevel::Config> levels,
+	    size_t element = sizeof(int)) :
+	    lineSize{std::max(line, size_t(1))},
+	    elementSize{element}
+	{
+		for(const sortvis::CacheLevel::Config& level : levels)
+		{
+			cacheLevels.emplace_back(level, lineSize);
+		}
+	}
+
+	/**
+	 * @return CacheSimulator with a typical desktop L1/L2/LLC geometry
+	 */
+	[[nodiscard]] static CacheSimulator typical()
+	{
+		using Replacement = sortvis::CacheLevel::Replacement;
+		return {DEFAULT_LINE_SIZE, {{"L1", 32 * 1024, 8, Replacement::LRU}, {"L2", 1024 * 1024, 16, Replacement::LRU},
+		                               {"LLC", 16 * 1024 * 1024, 16, Replacement::Random}}};
+	}
+
+	/**
+	 * @brief simulates an access to the element at idx
+	 *
+	 * @param idx index of the element
+	 */
+	void access(size_t idx) noexcept
+	{
+		const uint64_t line = idx * elementSize / lineSize;
+		for(sortvis::CacheLevel& level : cacheLevels)
+		{
+			if(level.access(line))
+			{
+				return;
+			}
+		}
+	}
+
+	/**
+	 * @brief empties all levels and resets their counters
+	 *
+	 */
+	void reset() noexcept
+	{
+		for(sortvis::CacheLevel& level : cacheLevels)
+		{
+			level.reset();
+		}
+	}
+
+	/**
+	 * @return const std::vector<sortvis::CacheLevel>& all levels, closest to the cpu first
+	 */
+	[[nodiscard]] const std::vector<sortvis::CacheLevel>& levels() const noexcept
+	{
+		return cacheLevels;
+	}
+};
+} // namespace sortvis
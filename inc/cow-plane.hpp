@@ -0,0 +1,331 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace sortvis
+{
+/**
+ * @brief fixed size array of chunks that copies share until they write to them,
+ * copies & assignments take O(size() / CHUNK_SIZE) and the first write to a shared chunk copies only that chunk
+ *
+ * @tparam T trivially copyable element type
+ */
+template<typename T>
+class CowPlane
+{
+public:
+	static constexpr size_t CHUNK_BITS = 12;
+	static constexpr size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+
+	using Chunk = std::array<T, CHUNK_SIZE>;
+
+private:
+	std::vector<std::shared_ptr<Chunk>> chunks;
+	std::vector<T*> data;               //! raw chunk pointers for element access
+	mutable std::vector<uint8_t> owned; //! 1 if no other plane refers to the chunk, copies clear it in both planes
+	size_t elements = 0;
+
+	/**
+	 * @return size_t number of chunks holding count elements
+	 */
+	[[nodiscard]] static size_t chunksFor(size_t count) noexcept
+	{
+		return (count + CHUNK_SIZE - 1) >> CHUNK_BITS;
+	}
+
+	/**
+	 * @brief refers to the chunks of other, neither plane may write to them in place afterwards
+	 *
+	 */
+	void share(const CowPlane& other)
+	{
+		chunks = other.chunks;
+		data = other.data;
+		elements = other.elements;
+		owned.assign(chunks.size(), 0);
+		std::fill(other.owned.begin(), other.owned.end(), uint8_t(0));
+	}
+
+	/**
+	 * @brief replaces a shared chunk with a copy only this plane refers to
+	 *
+	 * @throws std::bad_alloc if the copy can't be allocated
+	 */
+	void detach(size_t chunk)
+	{
+		chunks[chunk] = std::make_shared<Chunk>(*chunks[chunk]);
+		data[chunk] = chunks[chunk]->data();
+		owned[chunk] = 1;
+	}
+
+public:
+	/**
+	 * @brief random access iterator yielding the elements by value
+	 *
+	 */
+	class const_iterator
+	{
+	private:
+		const CowPlane* plane = nullptr;
+		size_t idx = 0;
+
+	public:
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::input_iterator_tag;
+		using value_type = T;
+		using difference_type = std::ptrdiff_t;
+		using reference = T;
+
+		const_iterator() noexcept = default;
+
+		const_iterator(const CowPlane* owner, size_t index) noexcept : plane{owner}, idx{index}
+		{
+		}
+
+		[[nodiscard]] T operator*() const noexcept
+		{
+			return (*plane)[idx];
+		}
+
+		[[nodiscard]] T operator[](difference_type offset) const noexcept
+		{
+			return (*plane)[static_cast<size_t>(static_cast<difference_type>(idx) + offset)];
+		}
+
+		const_iterator& operator++() noexcept
+		{
+			++idx;
+			return *this;
+		}
+
+		const_iterator operator++(int) noexcept
+		{
+			const_iterator copy = *this;
+			++idx;
+			return copy;
+		}
+
+		const_iterator& operator--() noexcept
+		{
+			--idx;
+			return *this;
+		}
+
+		const_iterator operator--(int) noexcept
+		{
+			const_iterator copy = *this;
+			--idx;
+			return copy;
+		}
+
+		const_iterator& operator+=(difference_type offset) noexcept
+		{
+			idx = static_cast<size_t>(static_cast<difference_type>(idx) + offset);
+			return *this;
+		}
+
+		const_iterator& operator-=(difference_type offset) noexcept
+		{
+			return *this += -offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator+(const_iterator it, difference_type offset) noexcept
+		{
+			return it += offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator+(difference_type offset, const_iterator it) noexcept
+		{
+			return it += offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator-(const_iterator it, difference_type offset) noexcept
+		{
+			return it -= offset;
+		}
+
+		[[nodiscard]] friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept
+		{
+			return static_cast<difference_type>(lhs.idx) - static_cast<difference_type>(rhs.idx);
+		}
+
+		[[nodiscard]] friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+		{
+			return lhs.idx == rhs.idx;
+		}
+
+		[[nodiscard]] friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) noexcept
+		{
+			return lhs.idx <=> rhs.idx;
+		}
+	};
+
+	CowPlane() noexcept = default;
+
+	/**
+	 * @brief Construct a new Cow Plane object of count elements equal to value
+	 *
+	 */
+	CowPlane(size_t count, T value)
+	{
+		assign(count, value);
+	}
+
+	/**
+	 * @brief Construct a new Cow Plane object holding a copy of values
+	 *
+	 */
+	explicit CowPlane(std::span<const T> values)
+	{
+		assign(values);
+	}
+
+	CowPlane(const CowPlane& other)
+	{
+		share(other);
+	}
+
+	CowPlane(CowPlane&&) noexcept = default;
+
+	CowPlane& operator=(const CowPlane& other)
+	{
+		if(this != &other)
+		{
+			share(other);
+		}
+		return *this;
+	}
+
+	CowPlane& operator=(CowPlane&&) noexcept = default;
+	~CowPlane() = default;
+
+	/**
+	 * @brief replaces all elements with count elements equal to value,
+	 * all chunks refer to a single shared chunk until they are written to
+	 *
+	 */
+	void assign(size_t count, T value)
+	{
+		auto filled = std::make_shared<Chunk>();
+		filled->fill(value);
+		chunks.assign(chunksFor(count), filled);
+		data.assign(chunks.size(), filled->data());
+		owned.assign(chunks.size(), 0);
+		elements = count;
+	}
+
+	/**
+	 * @brief replaces all elements with a copy of values
+	 *
+	 */
+	void assign(std::span<const T> values)
+	{
+		elements = values.size();
+		chunks.resize(chunksFor(elements));
+		data.resize(chunks.size());
+		owned.assign(chunks.size(), 1);
+		for(size_t chunk = 0; chunk < chunks.size(); ++chunk)
+		{
+			chunks[chunk] = std::make_shared_for_overwrite<Chunk>();
+			data[chunk] = chunks[chunk]->data();
+			const std::span<const T> part = values.subspan(chunk * CHUNK_SIZE);
+			std::copy_n(part.begin(), std::min(part.size(), CHUNK_SIZE), data[chunk]);
+		}
+	}
+
+	/**
+	 * @brief copies all shared chunks holding elements of [first, last),
+	 * afterwards threads may write to disjoint elements of the range concurrently
+	 *
+	 * @throws std::bad_alloc if a copy can't be allocated
+	 */
+	void detach(size_t first, size_t last)
+	{
+		for(size_t chunk = first >> CHUNK_BITS; first < last && chunk < chunksFor(last); ++chunk)
+		{
+			if(owned[chunk] == 0)
+			{
+				detach(chunk);
+			}
+		}
+	}
+
+	/**
+	 * @brief unchecked write access, copies the chunk of idx first if it is shared
+	 *
+	 * @param idx index to access
+	 * @return T& element at idx, valid until the next copy of this plane
+	 * @throws std::bad_alloc if the shared chunk can't be copied, so callers must not be noexcept
+	 */
+	[[nodiscard]] T& writable(size_t idx)
+	{
+		const size_t chunk = idx >> CHUNK_BITS;
+		if(owned[chunk] == 0)
+		{
+			detach(chunk);
+		}
+		return data[chunk][idx & (CHUNK_SIZE - 1)];
+	}
+
+	/**
+	 * @brief unchecked element access
+	 *
+	 */
+	[[nodiscard]] T operator[](size_t idx) const noexcept
+	{
+		return data[idx >> CHUNK_BITS][idx & (CHUNK_SIZE - 1)];
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return elements;
+	}
+
+	/**
+	 * @return size_t number of chunks only this plane refers to
+	 */
+	[[nodiscard]] size_t ownedChunks() const noexcept
+	{
+		return static_cast<size_t>(std::count(owned.begin(), owned.end(), uint8_t(1)));
+	}
+
+	[[nodiscard]] const_iterator begin() const noexcept
+	{
+		return {this, 0};
+	}
+
+	[[nodiscard]] const_iterator end() const noexcept
+	{
+		return {this, elements};
+	}
+
+	/**
+	 * @brief compares the elements, chunks shared by both planes are skipped
+	 *
+	 */
+	[[nodiscard]] friend bool operator==(const CowPlane& lhs, const CowPlane& rhs) noexcept
+	{
+		if(lhs.elements != rhs.elements)
+		{
+			return false;
+		}
+		for(size_t chunk = 0; chunk < lhs.chunks.size(); ++chunk)
+		{
+			const size_t count = std::min(CHUNK_SIZE, lhs.elements - chunk * CHUNK_SIZE);
+			if(lhs.data[chunk] != rhs.data[chunk] &&
+			    !std::equal(lhs.data[chunk], lhs.data[chunk] + count, rhs.data[chunk]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+};
+} // namespace sortvis
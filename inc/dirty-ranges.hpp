@@ -0,0 +1,177 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+namespace sortvis
+{
+/**
+ * @brief small sorted set of disjoint index ranges that changed since the last clear,
+ * neighbouring ranges with the smallest gap are merged once there are more than MAX_RANGES,
+ * copies & assignments mark everything as changed
+ *
+ */
+class DirtyRanges
+{
+public:
+	static constexpr size_t MAX_RANGES = 16;
+
+	/**
+	 * @brief the indices [first, last)
+	 *
+	 */
+	struct Range
+	{
+		size_t first = 0;
+		size_t last = 0;
+	};
+
+private:
+	std::array<Range, MAX_RANGES + 1> ranges{};
+	size_t count = 0;
+	bool everything = true;
+
+	/**
+	 * @brief merges the two neighbouring ranges with the smallest gap between them
+	 *
+	 */
+	void mergeClosest() noexcept
+	{
+		size_t closest = 0;
+		for(size_t i = 1; i + 1 < count; ++i)
+		{
+			if(ranges[i + 1].first - ranges[i].last < ranges[closest + 1].first - ranges[closest].last)
+			{
+				closest = i;
+			}
+		}
+		ranges[closest].last = ranges[closest + 1].last;
+		std::move(ranges.begin() + closest + 2, ranges.begin() + count, ranges.begin() + closest + 1);
+		--count;
+	}
+
+public:
+	DirtyRanges() noexcept = default;
+
+	DirtyRanges(const DirtyRanges&) noexcept
+	{
+	}
+
+	DirtyRanges(DirtyRanges&&) noexcept
+	{
+	}
+
+	DirtyRanges& operator=(const DirtyRanges&) noexcept
+	{
+		markAll();
+		return *this;
+	}
+
+	DirtyRanges& operator=(DirtyRanges&&) noexcept
+	{
+		markAll();
+		return *this;
+	}
+
+	~DirtyRanges() = default;
+
+	/**
+	 * @brief adds the indices [first, last)
+	 *
+	 * @param first first changed index
+	 * @param last one past the last changed index
+	 */
+	void mark(size_t first, size_t last) noexcept
+	{
+		if(everything || first >= last)
+		{
+			return;
+		}
+		Range* const begin = ranges.data();
+		Range* const end = begin + count;
+		Range* const touching = std::lower_bound(begin, end, first,
+		    [](const Range& range, size_t idx)
+		    {
+			    return range.last < idx;
+		    });
+
+		if(touching != end && touching->first <= last)
+		{
+			touching->first = std::min(touching->first, first);
+			touching->last = std::max(touching->last, last);
+			Range* next = touching + 1;
+			while(next != end && next->first <= touching->last)
+			{
+				touching->last = std::max(touching->last, next->last);
+				++next;
+			}
+			std::move(next, end, touching + 1);
+			count -= static_cast<size_t>(next - (touching + 1));
+			return;
+		}
+
+		std::move_backward(touching, end, end + 1);
+		*touching = {first, last};
+		if(++count > MAX_RANGES)
+		{
+			mergeClosest();
+		}
+	}
+
+	/**
+	 * @brief adds a single index
+	 *
+	 * @param idx changed index
+	 */
+	void mark(size_t idx) noexcept
+	{
+		mark(idx, idx + 1);
+	}
+
+	/**
+	 * @brief marks everything as changed
+	 *
+	 */
+	void markAll() noexcept
+	{
+		everything = true;
+		count = 0;
+	}
+
+	/**
+	 * @brief forgets all changes
+	 *
+	 */
+	void clear() noexcept
+	{
+		everything = false;
+		count = 0;
+	}
+
+	/**
+	 * @return true if everything changed, ranges are meaningless then
+	 */
+	[[nodiscard]] bool all() const noexcept
+	{
+		return everything;
+	}
+
+	/**
+	 * @return true if nothing changed
+	 */
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return !everything && count == 0;
+	}
+
+	/**
+	 * @return std::span<const Range> ascending disjoint changed ranges
+	 */
+	[[nodiscard]] std::span<const Range> get() const noexcept
+	{
+		return {ranges.data(), count};
+	}
+};
+} // namespace sortvis
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace sortvis
+{
+class ThreadPool;
+
+/**
+ * @brief counter based random number generator Philox4x32-10 (Salmon et al.),
+ * every number is a pure function of seed, counter & stream so any element can be generated independently
+ *
+ */
+class CounterRng
+{
+private:
+	uint64_t key;
+
+	static constexpr uint32_t MULTIPLIER_0 = 0xD2511F53;
+	static constexpr uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+	static constexpr uint32_t WEYL_0 = 0x9E3779B9;
+	static constexpr uint32_t WEYL_1 = 0xBB67AE85;
+	static constexpr size_t ROUNDS = 10;
+
+public:
+	/**
+	 * @brief Construct a new Counter Rng object
+	 *
+	 * @param seed key of the generator
+	 */
+	explicit constexpr CounterRng(uint64_t seed) noexcept : key{seed}
+	{
+	}
+
+	/**
+	 * @return std::array<uint32_t, 4> 128 random bits for counter & stream
+	 */
+	[[nodiscard]] constexpr std::array<uint32_t, 4> block(uint64_t counter, uint64_t stream = 0) const noexcept
+	{
+		std::array<uint32_t, 4> ctr{static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32),
+		    static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+		uint32_t key0 = static_cast<uint32_t>(key);
+		uint32_t key1 = static_cast<uint32_t>(key >> 32);
+		for(size_t round = 0; round < ROUNDS; ++round)
+		{
+			const uint64_t product0 = uint64_t(MULTIPLIER_0) * ctr[0];
+			const uint64_t product1 = uint64_t(MULTIPLIER_1) * ctr[2];
+			ctr = {static_cast<uint32_t>(product1 >> 32) ^ ctr[1] ^ key0, static_cast<uint32_t>(product1),
+			    static_cast<uint32_t>(product0 >> 32) ^ ctr[3] ^ key1, static_cast<uint32_t>(product0)};
+			key0 += WEYL_0;
+			key1 += WEYL_1;
+		}
+		return ctr;
+	}
+
+	/**
+	 * @return uint64_t 64 random bits for counter & stream
+	 */
+	[[nodiscard]] constexpr uint64_t operator()(uint64_t counter, uint64_t stream = 0) const noexcept
+	{
+		const std::array<uint32_t, 4> bits = block(counter, stream);
+		return (uint64_t(bits[1]) << 32) | bits[0];
+	}
+
+	/**
+	 * @return size_t random number in [0, bound), the modulo bias is below bound / 2^64
+	 */
+	[[nodiscard]] constexpr size_t below(size_t bound, uint64_t counter, uint64_t stream = 0) const noexcept
+	{
+		return (*this)(counter, stream) % bound;
+	}
+
+	/**
+	 * @return double random number in [0, 1) with 53 random bits
+	 */
+	[[nodiscard]] constexpr double unit(uint64_t counter, uint64_t stream = 0) const noexcept
+	{
+		return static_cast<double>((*this)(counter, stream) >> 11) * 0x1.0p-53;
+	}
+};
+
+/**
+ * @brief shapes of generated input, all values lie in [1, elements]
+ *
+ */
+enum class Distribution : uint8_t
+{
+	Random,       //! uniformly random permutation
+	Sorted,       //! ascending permutation
+	NearlySorted, //! ascending permutation after a few random swaps
+	Reversed,     //! descending permutation
+	Sawtooth,     //! ascending teeth of period elements each
+	FewUnique,    //! few distinct values evenly spread over [1, elements]
+	Zipf,         //! value v drawn with a probability proportional to 1 / v^exponent
+	OrganPipe,    //! permutation ascending to the middle and descending after it
+	Runs          //! random permutation with ascending runs of period elements each
+};
+
+constexpr std::array<Distribution, 9> DISTRIBUTIONS{Distribution::Random, Distribution::Sorted,
+    Distribution::NearlySorted, Distribution::Reversed, Distribution::Sawtooth, Distribution::FewUnique,
+    Distribution::Zipf, Distribution::OrganPipe, Distribution::Runs};
+
+/**
+ * @brief parameters of the distributions, 0 picks a default depending on the number of elements
+ *
+ */
+struct DistributionParameters
+{
+	size_t swaps = 0;          //! swaps of NearlySorted, default elements / 100
+	size_t period = 0;         //! elements per tooth of Sawtooth & per run of Runs, default sqrt(elements)
+	size_t unique = 8;         //! distinct values of FewUnique
+	double zipfExponent = 1.0; //! exponent of Zipf, larger values make small values more frequent
+};
+
+/**
+ * @brief fills values with distribution, the result only depends on seed & parameters,
+ * not on the previous values or the number of threads
+ *
+ * @param values span to fill
+ * @param distribution shape of the values
+ * @param seed seed of the CounterRng
+ * @param parameters parameters of the distribution
+ * @param pool threads to generate large inputs with, nullptr to generate on the calling thread
+ */
+void generate(std::span<int> values, sortvis::Distribution distribution, uint64_t seed,
+    const sortvis::DistributionParameters& parameters = {}, sortvis::ThreadPool* pool = nullptr);
+
+/**
+ * @return uint64_t a different seed on every call, drawn from a std::random_device once per process
+ */
+[[nodiscard]] uint64_t freshSeed();
+
+/**
+ * @return const char* name of distribution
+ */
+[[nodiscard]] const char* getDistributionName(sortvis::Distribution distribution) noexcept;
+} // namespace sortvis
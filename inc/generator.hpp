@@ -0,0 +1,454 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sortvis
+{
+/**
+ * @brief recycles coroutine frames by size, frames allocated while a Scope of an arena
+ * is active on the current thread are returned to that arena instead of the heap
+ *
+ */
+class FrameArena
+{
+private:
+	/**
+	 * @brief placed in front of every frame to find its arena on deallocation
+	 *
+	 */
+	struct alignas(std::max_align_t) Header
+	{
+		FrameArena* arena;
+		size_t size;
+	};
+
+	/**
+	 * @brief unused frames of one size
+	 *
+	 */
+	struct FreeList
+	{
+		size_t size;
+		std::vector<Header*> frames;
+	};
+
+	std::vector<FreeList> freeLists;
+	size_t heapAllocations = 0;
+
+	static inline thread_local FrameArena* current = nullptr;
+
+	/**
+	 * @return FreeList& for frames of size, created if there is none yet
+	 */
+	FreeList& freeList(size_t size)
+	{
+		for(FreeList& list : freeLists)
+		{
+			if(list.size == size)
+			{
+				return list;
+			}
+		}
+		return freeLists.emplace_back(FreeList{size, {}});
+	}
+
+public:
+	/**
+	 * @brief makes an arena the target for frame allocations on this thread while in scope
+	 *
+	 */
+	class Scope
+	{
+	private:
+		FrameArena* previous;
+
+	public:
+		explicit Scope(FrameArena& arena) noexcept : previous{std::exchange(current, &arena)}
+		{
+		}
+
+		Scope(Scope&&) = delete;
+		Scope(const Scope&) = delete;
+		Scope& operator=(Scope&&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+		~Scope()
+		{
+			current = previous;
+		}
+	};
+
+	FrameArena() = default;
+	FrameArena(FrameArena&&) = delete;
+	FrameArena(const FrameArena&) = delete;
+	FrameArena& operator=(FrameArena&&) = delete;
+	FrameArena& operator=(const FrameArena&) = delete;
+
+	/**
+	 * @brief frees all unused frames, frames still in use must not outlive the arena
+	 *
+	 */
+	~FrameArena()
+	{
+		for(FreeList& list : freeLists)
+		{
+			for(Header* header : list.frames)
+			{
+				::operator delete(header);
+			}
+		}
+	}
+
+	/**
+	 * @brief allocates a frame from the arena active on this thread or the heap
+	 *
+	 * @param size size of the frame
+	 * @return void* to the frame
+	 */
+	[[nodiscard]] static void* allocate(size_t size)
+	{
+		FrameArena* arena = current;
+		Header* header = nullptr;
+		if(arena != nullptr)
+		{
+			std::vector<Header*>& frames = arena->freeList(size).frames;
+			if(!frames.empty())
+			{
+				header = frames.back();
+				frames.pop_back();
+			}
+			else
+			{
+				++arena->heapAllocations;
+			}
+		}
+		if(header == nullptr)
+		{
+			header = static_cast<Header*>(::operator new(sizeof(Header) + size));
+		}
+		header->arena = arena;
+		header->size = size;
+		return header + 1;
+	}
+
+	/**
+	 * @brief returns a frame to the arena it was allocated from or the heap
+	 *
+	 * @param frame frame returned by allocate
+	 */
+	static void deallocate(void* frame) noexcept
+	{
+		Header* header = static_cast<Header*>(frame) - 1;
+		if(header->arena == nullptr)
+		{
+			::operator delete(header);
+			return;
+		}
+		try
+		{
+			header->arena->freeList(header->size).frames.push_back(header);
+		}
+		catch(...)
+		{
+			::operator delete(header);
+		}
+	}
+
+	/**
+	 * @return size_t number of frames this arena had to allocate from the heap
+	 */
+	[[nodiscard]] size_t allocations() const noexcept
+	{
+		return heapAllocations;
+	}
+};
+
+/**
+ * @brief lazily evaluated coroutine sequence of T, frames are allocated through FrameArena,
+ * co_yield of another Generator<T> yields all its values, resuming the innermost Generator directly
+ *
+ * @tparam T yielded type
+ */
+template<typename T>
+class [[nodiscard]] Generator
+{
+public:
+	using value_type = std::remove_cvref_t<T>;
+	using reference = std::conditional_t<std::is_reference_v<T>, T, T&>;
+	using pointer = std::add_pointer_t<reference>;
+
+	class promise_type
+	{
+	private:
+		pointer value = nullptr;
+		std::exception_ptr exception;
+		promise_type* root = this;      //! outermost Generator of the chain
+		promise_type* parent = nullptr; //! Generator that co_yielded this one
+		promise_type* leaf = this;      //! innermost running Generator, only maintained in root
+
+		/**
+		 * @brief transfers to the parent Generator at the end of a nested Generator
+		 *
+		 */
+		struct FinalAwaiter
+		{
+			bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+			{
+				promise_type& promise = handle.promise();
+				if(promise.parent == nullptr)
+				{
+					return std::noop_coroutine();
+				}
+				promise.root->leaf = promise.parent;
+				return std::coroutine_handle<promise_type>::from_promise(*promise.parent);
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+		};
+
+		/**
+		 * @brief starts a nested Generator and makes it the leaf of the chain
+		 *
+		 */
+		class NestedAwaiter
+		{
+		private:
+			promise_type* nested;
+
+		public:
+			explicit NestedAwaiter(Generator& generator) noexcept :
+			    nested{generator.coroutine ? &generator.coroutine.promise() : nullptr}
+			{
+			}
+
+			bool await_ready() const noexcept
+			{
+				return nested == nullptr;
+			}
+
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+			{
+				promise_type& promise = handle.promise();
+				nested->root = promise.root;
+				nested->parent = &promise;
+				promise.root->leaf = nested;
+				return std::coroutine_handle<promise_type>::from_promise(*nested);
+			}
+
+			void await_resume()
+			{
+				if(nested != nullptr)
+				{
+					nested->rethrowIfException();
+				}
+			}
+		};
+
+	public:
+		[[nodiscard]] static void* operator new(size_t size)
+		{
+			return sortvis::FrameArena::allocate(size);
+		}
+
+		static void operator delete(void* frame) noexcept
+		{
+			sortvis::FrameArena::deallocate(frame);
+		}
+
+		Generator get_return_object() noexcept
+		{
+			return Generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+		}
+
+		std::suspend_always initial_suspend() const noexcept
+		{
+			return {};
+		}
+
+		FinalAwaiter final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		std::suspend_always yield_value(std::remove_reference_t<T>& val) noexcept
+		{
+			value = std::addressof(val);
+			return {};
+		}
+
+		std::suspend_always yield_value(std::remove_reference_t<T>&& val) noexcept
+		{
+			value = std::addressof(val);
+			return {};
+		}
+
+		NestedAwaiter yield_value(Generator& generator) noexcept
+		{
+			return NestedAwaiter{generator};
+		}
+
+		NestedAwaiter yield_value(Generator&& generator) noexcept
+		{
+			return NestedAwaiter{generator};
+		}
+
+		void unhandled_exception() noexcept
+		{
+			exception = std::current_exception();
+		}
+
+		void return_void() noexcept
+		{
+		}
+
+		template<typename U>
+		std::suspend_never await_transform(U&&) = delete;
+
+		[[nodiscard]] reference get() const noexcept
+		{
+			return static_cast<reference>(*leaf->value);
+		}
+
+		/**
+		 * @brief resumes the innermost Generator of the chain, only valid on the root
+		 *
+		 */
+		void resume()
+		{
+			std::coroutine_handle<promise_type>::from_promise(*leaf).resume();
+		}
+
+		void rethrowIfException()
+		{
+			if(exception)
+			{
+				std::rethrow_exception(std::exchange(exception, nullptr));
+			}
+		}
+	};
+
+	struct sentinel
+	{
+	};
+
+	class iterator
+	{
+	private:
+		std::coroutine_handle<promise_type> coroutine = nullptr;
+
+	public:
+		using iterator_category = std::input_iterator_tag;
+		using difference_type = std::ptrdiff_t;
+		using value_type = Generator::value_type;
+		using reference = Generator::reference;
+		using pointer = Generator::pointer;
+
+		iterator() noexcept = default;
+
+		explicit iterator(std::coroutine_handle<promise_type> handle) noexcept : coroutine{handle}
+		{
+		}
+
+		[[nodiscard]] friend bool operator==(const iterator& it, sentinel) noexcept
+		{
+			return !it.coroutine || it.coroutine.done();
+		}
+
+		iterator& operator++()
+		{
+			coroutine.promise().resume();
+			if(coroutine.done())
+			{
+				coroutine.promise().rethrowIfException();
+			}
+			return *this;
+		}
+
+		void operator++(int)
+		{
+			++*this;
+		}
+
+		[[nodiscard]] reference operator*() const noexcept
+		{
+			return coroutine.promise().get();
+		}
+
+		[[nodiscard]] pointer operator->() const noexcept
+		{
+			return std::addressof(operator*());
+		}
+	};
+
+private:
+	std::coroutine_handle<promise_type> coroutine = nullptr;
+
+	explicit Generator(std::coroutine_handle<promise_type> handle) noexcept : coroutine{handle}
+	{
+	}
+
+public:
+	Generator() noexcept = default;
+
+	Generator(Generator&& other) noexcept : coroutine{std::exchange(other.coroutine, nullptr)}
+	{
+	}
+
+	Generator(const Generator&) = delete;
+
+	Generator& operator=(Generator&& other) noexcept
+	{
+		Generator moved(std::move(other));
+		std::swap(coroutine, moved.coroutine);
+		return *this;
+	}
+
+	Generator& operator=(const Generator&) = delete;
+
+	~Generator()
+	{
+		if(coroutine)
+		{
+			coroutine.destroy();
+		}
+	}
+
+	/**
+	 * @brief resumes the coroutine up to its first co_yield
+	 *
+	 * @return iterator to the first value
+	 */
+	iterator begin()
+	{
+		if(coroutine)
+		{
+			coroutine.resume();
+			if(coroutine.done())
+			{
+				coroutine.promise().rethrowIfException();
+			}
+		}
+		return iterator{coroutine};
+	}
+
+	sentinel end() const noexcept
+	{
+		return {};
+	}
+};
+} // namespace sortvis
@@ -2,20 +2,25 @@
 
 #include "sorter.hpp"
 
+#include <algorithm>
 #include <array>
 #include <charconv>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
 
 namespace sortvis
 {
 /**
  * @brief represents a string with a number at the end,
- * with fixed max size of 14
+ * with fixed max size of 31
  *
  */
 class NumberedString
 {
 private:
-	std::array<char, 15> string{'\0'};
+	std::array<char, 32> string{'\0'};
 	unsigned char staticSize;
 
 public:
@@ -35,7 +40,7 @@ public:
 	 *
 	 * @param num the number
 	 */
-	void update(unsigned num) noexcept
+	void update(uint64_t num) noexcept
 	{
 		auto result = std::to_chars(string.data() + staticSize, string.data() + (string.size() - 1), num);
 		*result.ptr = '\0';
@@ -57,6 +62,13 @@ public:
 struct BarLabels
 {
 	std::array<NumberedString, 4> data{"swap ", "compare ", "sorted ", "none "};
+	NumberedString vectorOps{"vector "};       //! compare-exchanges of up to 8 pairs, also counted as compares & swaps
+	NumberedString reads{"read "};             //! element reads through SortableCollection::read
+	NumberedString writes{"write "};           //! element writes through SortableCollection::write
+	NumberedString peakAuxBytes{"aux bytes "}; //! most bytes held in aux arrays at once
+	NumberedString sequential{"sequential "};  //! parallel steps whose lanes ran one after another
+	std::vector<NumberedString> cacheHits{};   //! one per simulated cache level, empty if not simulated
+	std::vector<NumberedString> cacheMisses{}; //! one per simulated cache level, empty if not simulated
 	sortvis::NumberedString& write()
 	{
 		return data[0];
@@ -85,6 +97,228 @@ struct BarLabels
 		read().update(sorter.data().getCounter(sortvis::Sortable::AccessState::Read));
 		full().update(sorter.data().getCounter(sortvis::Sortable::SortState::Full));
 		none().update(sorter.data().getCounter(sortvis::Sortable::SortState::None));
+		vectorOps.update(sorter.data().getVectorOps());
+		reads.update(sorter.data().getReads());
+		writes.update(sorter.data().getWrites());
+		peakAuxBytes.update(sorter.data().getPeakAuxBytes());
+		sequential.update(sorter.data().getSequentialLaneSteps());
+
+		const sortvis::CacheSimulator* cache = sorter.cacheSimulator();
+		if(cache == nullptr)
+		{
+			cacheHits.clear();
+			cacheMisses.clear();
+			return;
+		}
+		const std::vector<sortvis::CacheLevel>& levels = cache->levels();
+		if(cacheMisses.size() != levels.size())
+		{
+			cacheHits.clear();
+			cacheMisses.clear();
+			for(const sortvis::CacheLevel& level : levels)
+			{
+				cacheHits.emplace_back((std::string(level.name()) + " hit ").c_str());
+				cacheMisses.emplace_back((std::string(level.name()) + " miss ").c_str());
+			}
+		}
+		for(size_t level = 0; level < levels.size(); ++level)
+		{
+			cacheHits[level].update(levels[level].hits());
+			cacheMisses[level].update(levels[level].misses());
+		}
+	}
+};
+
+/**
+ * @brief per pixel column aggregate of a Sorters SortableCollection,
+ * used to draw collections with more elements than the plot has pixels
+ *
+ */
+class BarColumns
+{
+public:
+	/**
+	 * @brief how a column is drawn, same order as BarLabels
+	 *
+	 */
+	enum class Display : uint8_t
+	{
+		Write,
+		Read,
+		Full,
+		None
+	};
+
+	static constexpr size_t DISPLAY_COUNT = 4;
+
+	/**
+	 * @brief smallest & largest value of the elements in a column and its dominant Display,
+	 * Write or Read if any element has that AccessState, otherwise the more common SortState,
+	 * drawn as a solid bar up to min & a faded one from min to max, so unsorted columns stand out
+	 *
+	 */
+	struct Column
+	{
+		int min = 0;
+		int max = 0;
+		Display display = Display::None;
+	};
+
+private:
+	std::vector<Column> columns;
+	size_t elements = 0;
+
+	/**
+	 * @param idx index of an element
+	 * @return size_t index of the column holding idx
+	 */
+	[[nodiscard]] size_t columnOf(size_t idx) const noexcept
+	{
+		return ((idx + 1) * columns.size() + elements - 1) / elements - 1;
+	}
+
+	/**
+	 * @brief recomputes a single column from data
+	 *
+	 * @tparam DATA SortableCollection or AuxArray
+	 * @param data the columns were aggregated from
+	 * @param col index of the column
+	 */
+	template<typename DATA>
+	void aggregateColumn(const DATA& data, size_t col)
+	{
+		const size_t first = col * elements / columns.size();
+		const size_t last = (col + 1) * elements / columns.size();
+		Column column{std::numeric_limits<int>::max(), std::numeric_limits<int>::min(), Display::None};
+		std::array<size_t, DISPLAY_COUNT> counts{};
+		for(size_t idx = first; idx < last; ++idx)
+		{
+			const sortvis::Sortable element = data[idx];
+			column.min = std::min(column.min, element.value);
+			column.max = std::max(column.max, element.value);
+			++counts[static_cast<size_t>(display(element))];
+		}
+		if(counts[static_cast<size_t>(Display::Write)] > 0)
+		{
+			column.display = Display::Write;
+		}
+		else if(counts[static_cast<size_t>(Display::Read)] > 0)
+		{
+			column.display = Display::Read;
+		}
+		else if(counts[static_cast<size_t>(Display::Full)] > counts[static_cast<size_t>(Display::None)])
+		{
+			column.display = Display::Full;
+		}
+		columns[col] = column;
+	}
+
+public:
+	/**
+	 * @param element Sortable to draw
+	 * @return Display the AccessState if it is Write or Read, otherwise the SortState
+	 */
+	[[nodiscard]] static Display display(const sortvis::Sortable& element) noexcept
+	{
+		if(element == sortvis::Sortable::AccessState::Write)
+		{
+			return Display::Write;
+		}
+		if(element == sortvis::Sortable::AccessState::Read)
+		{
+			return Display::Read;
+		}
+		return element == sortvis::Sortable::SortState::Full ? Display::Full : Display::None;
+	}
+
+	/**
+	 * @param element Sortable to draw
+	 * @return Column of the single element, min & max are its value
+	 */
+	[[nodiscard]] static Column single(const sortvis::Sortable& element) noexcept
+	{
+		return {element.value, element.value, display(element)};
+	}
+
+	/**
+	 * @brief aggregates data into columnCount columns,
+	 * column c holds the elements [c * size / columnCount, (c + 1) * size / columnCount)
+	 *
+	 * @tparam DATA SortableCollection or AuxArray
+	 * @param data to aggregate
+	 * @param columnCount number of columns, clamped to [1, data.size()]
+	 */
+	template<typename DATA>
+	void aggregate(const DATA& data, size_t columnCount)
+	{
+		elements = data.size();
+		columns.resize(std::clamp(columnCount, size_t(1), std::max(elements, size_t(1))));
+		for(size_t col = 0; col < columns.size(); ++col)
+		{
+			aggregateColumn(data, col);
+		}
+	}
+
+	/**
+	 * @brief reaggregates the columns touched by changes of the Sorters data since the last update
+	 * and acknowledges them, everything if the column count or size changed
+	 *
+	 * @param sorter Sorter to aggregate
+	 * @param columnCount number of columns
+	 * @return true if any column was recomputed
+	 */
+	bool update(const sortvis::Sorter& sorter, size_t columnCount)
+	{
+		const sortvis::SortableCollection& data = sorter.data();
+		const sortvis::DirtyRanges& changes = data.changes();
+		const size_t clamped = std::clamp(columnCount, size_t(1), std::max(data.size(), size_t(1)));
+		if(changes.all() || clamped != columns.size() || data.size() != elements)
+		{
+			aggregate(data, columnCount);
+		}
+		else if(changes.empty())
+		{
+			return false;
+		}
+		else
+		{
+			for(const sortvis::DirtyRanges::Range& range : changes.get())
+			{
+				for(size_t col = columnOf(range.first); col <= columnOf(range.last - 1); ++col)
+				{
+					aggregateColumn(data, col);
+				}
+			}
+		}
+		data.acknowledgeChanges();
+		return true;
+	}
+
+	/**
+	 * @return size_t number of columns
+	 */
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return columns.size();
+	}
+
+	/**
+	 * @return double number of elements per column
+	 */
+	[[nodiscard]] double width() const noexcept
+	{
+		return columns.empty() ? 1.0 : static_cast<double>(elements) / static_cast<double>(columns.size());
+	}
+
+	/**
+	 * @brief unchecked column access
+	 *
+	 * @param col index of the column
+	 * @return const Column& the column
+	 */
+	[[nodiscard]] const Column& operator[](size_t col) const noexcept
+	{
+		return columns[col];
 	}
 };
 } // namespace sortvis
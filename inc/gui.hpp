@@ -9,6 +9,7 @@
 #include <implot.h>
 
 #include "gui-help.hpp"
+#include "registry.hpp"
 #include "sortable.hpp"
 #include "sorter.hpp"
 
@@ -16,6 +17,12 @@ namespace sortvis
 {
 constexpr unsigned FRAMERATE = 30;
 
+/**
+ * @brief maximum time per frame spent advancing sorters, steps left over are dropped
+ *
+ */
+constexpr std::chrono::milliseconds ADVANCE_BUDGET{1000 / FRAMERATE / 2};
+
 /**
  * @brief clears least significant bit to make unsigned number even
  *
@@ -39,9 +46,14 @@ public:
 	int elements = 32;
 	int sortersPerRow = 3;
 	int sortersPerCol = 2;
+	int distribution = 0; //! index into sortvis::DISTRIBUTIONS of the input
 	float advanceDelta = 0;
 	float advanceDelay = 0.2f;
 	bool autoReset = false;
+	bool precompute = false;
+	bool parallel = false;
+	bool simulateCache = false;
+	bool paused = false;
 	bool showAbout = false;
 
 	ImVec2 windowSize;
@@ -53,25 +65,43 @@ public:
 	sortvis::SortableCollection sortables;
 	sortvis::SorterCollection sorters;
 	sortvis::BarLabels barLabels;
+	std::vector<sortvis::BarColumns> barColumns;
 
 	GUIData() :
 	    sortables(elements, true),
-	    sorters(
-	        sortables, {sortvis::algorithms::bubble, sortvis::algorithms::quick, sortvis::algorithms::shell,
-	                       sortvis::algorithms::heap, sortvis::algorithms::insertion, sortvis::algorithms::selection})
+	    sorters(sortables, sortvis::registeredSorterAlgorithms()),
+	    barColumns(sorters.size())
 	{
 	}
 
 public:
 	/**
-	 * @brief resize to 'elements' and randomize 'sortables'
+	 * @brief resize to 'elements' and fill 'sortables' with fresh input of 'distribution',
+	 * sorters run in the background if 'precompute' is set
 	 *
 	 */
 	void resetSorters()
 	{
 		sortables = sortvis::SortableCollection(elements);
-		sortables.randomize();
-		sorters.reset(sortables);
+		sortables.generate(sortvis::DISTRIBUTIONS[static_cast<size_t>(distribution)], sortvis::freshSeed());
+		sorters.reset(sortables, precompute ? sortvis::Sorter::Mode::Traced : sortvis::Sorter::Mode::Direct);
+	}
+
+	/**
+	 * @brief gives every sorter a typical cache hierarchy to simulate if 'simulateCache' is set,
+	 * counting starts with the next reset
+	 *
+	 */
+	void updateCacheSimulation()
+	{
+		if(simulateCache)
+		{
+			sorters.simulateCache(sortvis::CacheSimulator::typical());
+		}
+		else
+		{
+			sorters.stopSimulatingCache();
+		}
 	}
 
 	/**
@@ -83,12 +113,18 @@ public:
 		deltaTime = deltaClock.restart();
 		advanceDelta += deltaTime.asSeconds();
 
-		while(advanceDelta > advanceDelay)
+		if(paused)
+		{
+			advanceDelta = 0;
+		}
+
+		const auto steps = static_cast<size_t>(advanceDelta / advanceDelay);
+		advanceDelta -= static_cast<float>(steps) * advanceDelay;
+		if(steps > 0)
 		{
-			advanceDelta -= advanceDelay;
 			if(!sorters.allHaveFinished())
 			{
-				sorters.advance();
+				sorters.advanceUntil(std::chrono::steady_clock::now() + ADVANCE_BUDGET, steps);
 			}
 			else if(autoReset)
 			{
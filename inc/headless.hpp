@@ -0,0 +1,131 @@
+#pragma once
+
+#include "distribution.hpp"
+#include "registry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief runs SorterCollections to completion without a window & prints their statistics
+ *
+ */
+namespace sortvis::headless
+{
+/**
+ * @brief output format of the statistics
+ *
+ */
+enum class Format : uint8_t
+{
+	Csv, //! header line & one line per run
+	Json //! array of one object per run
+};
+
+/**
+ * @brief what to run, every algorithm runs on every combination of size, input & seed
+ *
+ */
+struct Options
+{
+	std::vector<std::string> algorithms; //! registered names, empty for all registered algorithms
+	std::vector<size_t> sizes{1'000};
+	std::vector<uint64_t> seeds{1};
+	std::vector<sortvis::Distribution> inputs{sortvis::Distribution::Random};
+	sortvis::headless::Format format = sortvis::headless::Format::Csv;
+	size_t maxSteps = SIZE_MAX; //! steps after which each Sorter is stopped
+	size_t threads = 1;         //! threads advancing the Sorters, more threads skew the wall times
+	std::filesystem::path plugins = sortvis::PLUGIN_DIRECTORY;
+};
+
+/**
+ * @brief statistics of one Sorter
+ *
+ */
+struct Run
+{
+	std::string algorithm;
+	sortvis::Distribution input = sortvis::Distribution::Random;
+	size_t elements = 0;
+	uint64_t seed = 0;
+	size_t steps = 0;
+	uint64_t compares = 0;
+	uint64_t swaps = 0;
+	uint64_t reads = 0;      //! element reads through SortableCollection::read, e.g. of the merge & radix sorts
+	uint64_t writes = 0;     //! element writes through SortableCollection::write
+	uint64_t vectorOps = 0;  //! compare-exchanges of up to 8 pairs, also counted as compares & swaps
+	size_t peakAuxBytes = 0; //! most bytes held in aux arrays at once
+	double seconds = 0;      //! wall time spent advancing the Sorter
+	bool finished = false;   //! false if stopped after maxSteps
+	bool sorted = false;     //! the result is the sorted input
+};
+
+/**
+ * @brief writes Runs as they complete, nothing is written before the first Run, call finish after the last one
+ *
+ */
+class RunWriter
+{
+private:
+	std::ostream& out;
+	sortvis::headless::Format format;
+	size_t written = 0;
+
+	/**
+	 * @brief writes the CSV header or opens the JSON array
+	 *
+	 */
+	void begin();
+
+public:
+	RunWriter(std::ostream& output, sortvis::headless::Format outputFormat);
+
+	/**
+	 * @brief writes run & flushes, the first call writes the CSV header or opens the JSON array first
+	 *
+	 */
+	void write(const sortvis::headless::Run& run);
+
+	/**
+	 * @brief closes the JSON array, writes an empty table if nothing was written
+	 *
+	 */
+	void finish();
+};
+
+/**
+ * @brief parses the arguments of SortVis after the program name,
+ * lists are comma separated & names are the ones shown by the GUI
+ *
+ * @throws std::invalid_argument for unknown or malformed arguments
+ */
+[[nodiscard]] sortvis::headless::Options parseArguments(std::span<const std::string_view> args);
+
+/**
+ * @brief loads the plugins of options, then runs & writes every combination of options
+ *
+ * @return size_t number of finished Runs that did not sort their input
+ * @throws std::invalid_argument for unknown algorithm names
+ * @throws PluginException if a plugin could not be loaded
+ */
+size_t run(const sortvis::headless::Options& options, sortvis::headless::RunWriter& writer);
+
+/**
+ * @return std::string usage of the headless mode of program
+ */
+[[nodiscard]] std::string usage(std::string_view program);
+
+/**
+ * @brief headless entry point of SortVis, writes the statistics to std::cout & errors to std::cerr
+ *
+ * @param args all arguments including the program name
+ * @return int EXIT_SUCCESS if all finished Runs sorted their input
+ */
+int main(std::span<char*> args);
+} // namespace sortvis::headless
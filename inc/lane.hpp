@@ -0,0 +1,281 @@
+#pragma once
+
+#include "sortable.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace sortvis
+{
+/**
+ * @brief view of the indices [offset(), offset() + size()) of a SortableCollection for one worker thread,
+ * indices are relative to offset(), lanes with disjoint ranges may access the collection concurrently,
+ * counters, changes, cursor & Operations for the trace and cache are collected per lane
+ * and merged into the collection by join
+ *
+ */
+class Lane
+{
+private:
+	sortvis::SortableCollection* collection;
+	size_t laneIdx;
+	size_t first = 0;
+	size_t count = 0;
+	size_t cursorIdx = sortvis::SortableCollection::NO_CURSOR;
+	size_t changedFirst = SIZE_MAX;
+	size_t changedLast = 0;
+	std::array<uint64_t, 3> accessCounter{0, 0, 0};
+	uint64_t fullCounter = 0;
+	std::array<sortvis::SortableCollection::DistanceHistogram, 3> distanceHistograms{};
+	std::vector<sortvis::Operation> operations; //! for the trace & cache of the collection, in order
+	bool buffering = false;
+
+	/**
+	 * @brief remembers an absolute index as changed
+	 *
+	 */
+	void mark(size_t idx) noexcept
+	{
+		changedFirst = std::min(changedFirst, idx);
+		changedLast = std::max(changedLast, idx + 1);
+	}
+
+	/**
+	 * @brief counts a compare or swap of absolute indices & moves the cursor to lhs
+	 *
+	 */
+	void countAccess(sortvis::Operation::Type type, sortvis::Sortable::AccessState state, size_t lhs, size_t rhs)
+	{
+		if(buffering)
+		{
+			operations.push_back({type, 0, static_cast<uint32_t>(lhs), static_cast<uint32_t>(rhs)});
+		}
+		accessCounter[static_cast<size_t>(state)]++;
+		distanceHistograms[static_cast<size_t>(state)][sortvis::SortableCollection::distanceBucket(lhs, rhs)]++;
+		cursorIdx = lhs;
+	}
+
+	/**
+	 * @brief counts a compare of absolute indices & sets both to Read
+	 *
+	 */
+	void compare(size_t lhs, size_t rhs)
+	{
+		countAccess(sortvis::Operation::Type::Compare, sortvis::Sortable::AccessState::Read, lhs, rhs);
+		collection->accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Read;
+		collection->accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Read;
+		mark(lhs);
+		mark(rhs);
+	}
+
+public:
+	/**
+	 * @brief Construct a new Lane object covering nothing
+	 *
+	 * @param data SortableCollection to access, must outlive the Lane
+	 * @param idx index of the lane, used for its cursor
+	 */
+	Lane(sortvis::SortableCollection& data, size_t idx) noexcept : collection{&data}, laneIdx{idx}
+	{
+	}
+
+	/**
+	 * @brief member access like the std::shared_ptr of the instrumented policy
+	 *
+	 */
+	[[nodiscard]] Lane* operator->() noexcept
+	{
+		return this;
+	}
+
+	/**
+	 * @brief moves the lane to cover [firstIdx, firstIdx + elements) & hides its cursor,
+	 * only valid while no lane of the collection is running,
+	 * copies shared chunks of the range up front as lanes must not copy them concurrently
+	 *
+	 * @param firstIdx first absolute index of the lane
+	 * @param elements number of elements
+	 */
+	void retarget(size_t firstIdx, size_t elements)
+	{
+		first = firstIdx;
+		count = elements;
+		cursorIdx = sortvis::SortableCollection::NO_CURSOR;
+		buffering = collection->trace || collection->cache;
+		collection->valuePlane.detach(first, first + count);
+		collection->sortPlane.detach(first, first + count);
+		collection->accessPlane.detach(first, first + count);
+	}
+
+	/**
+	 * @return size_t absolute index of relative index 0
+	 */
+	[[nodiscard]] size_t offset() const noexcept
+	{
+		return first;
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return count;
+	}
+
+	/**
+	 * @brief compares both indices with operator <,
+	 * sets AccessState of Sortables to Read
+	 *
+	 * @param lhs left index into the lane
+	 * @param rhs right index into the lane
+	 * @return true if data[lhs] < data[rhs]
+	 */
+	bool less(size_t lhs, size_t rhs)
+	{
+		lhs += first;
+		rhs += first;
+		compare(lhs, rhs);
+		return collection->valuePlane[lhs] < collection->valuePlane[rhs];
+	}
+
+	/**
+	 * @brief compares both indices with operator >,
+	 * sets AccessState of Sortables to Read
+	 *
+	 * @param lhs left index into the lane
+	 * @param rhs right index into the lane
+	 * @return true if data[lhs] > data[rhs]
+	 */
+	bool greater(size_t lhs, size_t rhs)
+	{
+		lhs += first;
+		rhs += first;
+		compare(lhs, rhs);
+		return collection->valuePlane[lhs] > collection->valuePlane[rhs];
+	}
+
+	/**
+	 * @brief compares an element of the lane with an element no lane writes to, only the lanes
+	 * element is set to Read so lanes may compare against the same shared element concurrently
+	 *
+	 * @param idx index into the lane
+	 * @param shared absolute index into the collection
+	 * @return true if data[idx] < data[shared]
+	 */
+	bool lessThanShared(size_t idx, size_t shared)
+	{
+		countAccess(sortvis::Operation::Type::Compare, sortvis::Sortable::AccessState::Read, first + idx, shared);
+		collection->accessPlane.writable(first + idx) = sortvis::Sortable::AccessState::Read;
+		mark(first + idx);
+		return collection->valuePlane[first + idx] < collection->valuePlane[shared];
+	}
+
+	/**
+	 * @brief swaps values at indices,
+	 * sets AccessState of Sortables to Write
+	 *
+	 * @param lhs left index into the lane
+	 * @param rhs right index into the lane
+	 */
+	void swap(size_t lhs, size_t rhs)
+	{
+		lhs += first;
+		rhs += first;
+		assert(collection->sortPlane[lhs] != sortvis::Sortable::SortState::Full);
+		assert(collection->sortPlane[rhs] != sortvis::Sortable::SortState::Full);
+		countAccess(sortvis::Operation::Type::Swap, sortvis::Sortable::AccessState::Write, lhs, rhs);
+		collection->accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Write;
+		collection->accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Write;
+		mark(lhs);
+		mark(rhs);
+		std::swap(collection->valuePlane.writable(lhs), collection->valuePlane.writable(rhs));
+	}
+
+	/**
+	 * @brief Sets the state of all Sortables at indices of the lane to state,
+	 * if SortState == Full sort counters will be updated on join
+	 *
+	 * @tparam STATE sortvis::SortableState
+	 * @tparam IDX... std::unsigned_integral
+	 * @param state state to set
+	 * @param idx... indices into the lane to set
+	 */
+	template<sortvis::SortableState STATE, std::unsigned_integral... IDX>
+	void state(STATE state, IDX... idx)
+	{
+		if(buffering)
+		{
+			constexpr auto type = std::is_same_v<STATE, sortvis::Sortable::SortState>
+			                          ? sortvis::Operation::Type::SortState
+			                          : sortvis::Operation::Type::AccessState;
+			(operations.push_back({type, static_cast<uint8_t>(state), static_cast<uint32_t>(first + idx)}), ...);
+		}
+		sortvis::CowPlane<STATE>& states = collection->plane<STATE>();
+		((states.writable(first + idx) = state), ...);
+		(mark(first + idx), ...);
+		if constexpr(std::is_same_v<STATE, sortvis::Sortable::SortState>)
+		{
+			if(state == sortvis::Sortable::SortState::Full)
+			{
+				fullCounter += sizeof...(IDX);
+			}
+		}
+	}
+
+	/**
+	 * @brief merges counters, changes, cursors & buffered Operations of all lanes into data in lane order,
+	 * only valid while none of the lanes is running
+	 *
+	 * @param data SortableCollection of the lanes
+	 * @param lanes lanes to merge
+	 */
+	static void join(sortvis::SortableCollection& data, std::span<Lane> lanes)
+	{
+		using AccessState = sortvis::Sortable::AccessState;
+		using SortState = sortvis::Sortable::SortState;
+		for(Lane& lane : lanes)
+		{
+			for(const sortvis::Operation& op : lane.operations)
+			{
+				if(data.trace)
+				{
+					data.trace->push(op);
+				}
+				if(op.type == sortvis::Operation::Type::Compare || op.type == sortvis::Operation::Type::Swap)
+				{
+					data.simulateAccess(op.lhs, op.rhs);
+				}
+			}
+			lane.operations.clear();
+
+			for(AccessState state : {AccessState::Read, AccessState::Write})
+			{
+				const auto idx = static_cast<size_t>(state);
+				data.accessCounter[idx] += std::exchange(lane.accessCounter[idx], 0);
+				for(size_t bucket = 0; bucket < sortvis::SortableCollection::DISTANCE_BUCKETS; ++bucket)
+				{
+					data.distanceHistograms[idx][bucket] += std::exchange(lane.distanceHistograms[idx][bucket], 0);
+				}
+			}
+			data.sortCounter[static_cast<size_t>(SortState::None)] -= lane.fullCounter;
+			data.sortCounter[static_cast<size_t>(SortState::Full)] += std::exchange(lane.fullCounter, 0);
+
+			data.changed.mark(lane.changedFirst, lane.changedLast);
+			lane.changedFirst = SIZE_MAX;
+			lane.changedLast = 0;
+
+			const std::span<const size_t> cursors = data.cursors();
+			const size_t previous =
+			    lane.laneIdx < cursors.size() ? cursors[lane.laneIdx] : sortvis::SortableCollection::NO_CURSOR;
+			if(previous != lane.cursorIdx)
+			{
+				data.cursor(lane.laneIdx, lane.cursorIdx);
+			}
+		}
+	}
+};
+} // namespace sortvis
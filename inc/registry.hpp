@@ -0,0 +1,145 @@
+#pragma once
+
+#include "algorithms.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief declares the entry point of a plugin, define it once per plugin as
+ * SORTVIS_PLUGIN_ENTRY sortvisPlugin() { ... } returning a pointer to a static PluginManifest
+ *
+ */
+#if defined(_WIN32)
+#define SORTVIS_PLUGIN_ENTRY extern "C" __declspec(dllexport) const sortvis::PluginManifest*
+#else
+#define SORTVIS_PLUGIN_ENTRY extern "C" __attribute__((visibility("default"))) const sortvis::PluginManifest*
+#endif
+
+namespace sortvis
+{
+/**
+ * @brief extra memory an algorithm needs besides the elements
+ *
+ */
+enum class AuxMemory : uint8_t
+{
+	Constant,    //! a fixed number of elements & indices
+	Logarithmic, //! a stack of O(log n) ranges
+	Linear       //! aux arrays of O(n) elements
+};
+
+/**
+ * @brief a SorterAlgorithm with everything the GUI & bench need to know about it
+ *
+ */
+struct AlgorithmInfo
+{
+	const char* name = "UNKNOWN";
+	sortvis::SorterAlgorithm algorithm = nullptr;
+	sortvis::NativeAlgorithm native = nullptr; //! the same algorithm without instrumentation, optional
+	bool stable = false;                       //! keeps the order of equal elements
+	sortvis::AuxMemory auxMemory = sortvis::AuxMemory::Constant;
+	size_t maxElements = SIZE_MAX; //! recommended maximum number of elements to visualize
+};
+
+/**
+ * @brief incremented whenever AlgorithmInfo, PluginManifest or the layout of SortableCollection change
+ *
+ */
+constexpr uint32_t PLUGIN_API_VERSION = 1;
+
+/**
+ * @brief name of the function a plugin exports through SORTVIS_PLUGIN_ENTRY
+ *
+ */
+constexpr const char* PLUGIN_ENTRY_NAME = "sortvisPlugin";
+
+/**
+ * @brief directory SortVis & SortVis-bench load plugins from by default, relative to the working directory
+ *
+ */
+constexpr const char* PLUGIN_DIRECTORY = "plugins";
+
+/**
+ * @brief returned by the entry point of a plugin, plugins have to be built from the same headers
+ * with the same compiler as SortVis, apiVersion & collectionSize detect the most common mismatches
+ *
+ */
+struct PluginManifest
+{
+	uint32_t apiVersion = sortvis::PLUGIN_API_VERSION;
+	size_t collectionSize = sizeof(sortvis::SortableCollection);
+	const sortvis::AlgorithmInfo* algorithms = nullptr;
+	size_t count = 0;
+};
+
+using PluginEntry = const sortvis::PluginManifest* (*)();
+
+/**
+ * @brief Thrown if a plugin could not be loaded or registered
+ *
+ */
+class PluginException : public std::runtime_error
+{
+	using std::runtime_error::runtime_error;
+};
+
+/**
+ * @brief adds an algorithm after all registered ones, the built in algorithms are registered from the start,
+ * not thread safe with running Sorters, register everything at startup
+ *
+ * @param info the algorithm, its name has to outlive the registry
+ * @throws PluginException if the algorithm or its name are already registered
+ */
+void registerAlgorithm(const sortvis::AlgorithmInfo& info);
+
+/**
+ * @return std::vector<sortvis::AlgorithmInfo> all registered algorithms in order of registration
+ */
+[[nodiscard]] std::vector<sortvis::AlgorithmInfo> registeredAlgorithms();
+
+/**
+ * @return std::vector<sortvis::SorterAlgorithm> all registered SorterAlgorithms in order of registration
+ */
+[[nodiscard]] std::vector<sortvis::SorterAlgorithm> registeredSorterAlgorithms();
+
+/**
+ * @return const sortvis::AlgorithmInfo* registered info of algorithm or nullptr
+ */
+[[nodiscard]] const sortvis::AlgorithmInfo* findAlgorithm(sortvis::SorterAlgorithm algorithm);
+
+/**
+ * @return const sortvis::AlgorithmInfo* registered info of the algorithm named name or nullptr
+ */
+[[nodiscard]] const sortvis::AlgorithmInfo* findAlgorithm(std::string_view name);
+
+/**
+ * @brief loads a shared library and registers all algorithms of its PluginManifest,
+ * the library stays loaded until the process exits
+ *
+ * @param library path of the .so or .dll
+ * @return size_t number of registered algorithms
+ * @throws PluginException if the library or its entry point can't be loaded, the manifest does not match
+ * this build or an algorithm is already registered
+ */
+size_t loadPlugin(const std::filesystem::path& library);
+
+/**
+ * @brief calls loadPlugin for every .so (.dll on Windows) in directory, a missing directory holds no plugins
+ *
+ * @param directory directory to search, not recursive
+ * @return size_t number of registered algorithms
+ * @throws PluginException after trying all plugins if any of them failed, listing every failure
+ */
+size_t loadPlugins(const std::filesystem::path& directory);
+
+/**
+ * @return const char* name of aux
+ */
+[[nodiscard]] const char* getAuxMemoryName(sortvis::AuxMemory aux) noexcept;
+} // namespace sortvis
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "sortable.hpp"
+
+#include <cstddef>
+#include <span>
+
+/**
+ * @brief vectorized kernels on plain ints, only call them if supported() is true
+ *
+ */
+namespace sortvis::simd
+{
+constexpr size_t WIDTH = sortvis::SortableCollection::VECTOR_WIDTH;
+constexpr size_t BLOCK = WIDTH * WIDTH; //! elements sorted by one bitonic network
+
+/**
+ * @return true if the cpu & os support AVX2, detected once at runtime
+ */
+[[nodiscard]] bool supported() noexcept;
+
+/**
+ * @brief sorts every BLOCK elements of data with a bitonic network on 8 x int32 registers,
+ * a shorter last block is padded with the largest int
+ *
+ * @param data ints to sort blockwise in place
+ */
+void sortBlocks(std::span<int> data) noexcept;
+
+/**
+ * @brief merges two sorted ranges, WIDTH elements at a time with a bitonic merge network
+ *
+ * @param lhs sorted range
+ * @param rhs sorted range
+ * @param out destination of lhs.size() + rhs.size() elements, must not overlap lhs or rhs
+ */
+void merge(std::span<const int> lhs, std::span<const int> rhs, int* out) noexcept;
+} // namespace sortvis::simd
@@ -1,13 +1,26 @@
 #pragma once
 
+#include "cache-simulator.hpp"
+#include "cow-plane.hpp"
+#include "dirty-ranges.hpp"
+#include "distribution.hpp"
+#include "trace.hpp"
+
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cassert>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <numeric>
-#include <random>
+#include <span>
 #include <vector>
 
 namespace sortvis
 {
+class Lane;
+
 /**
  * @brief Value for SortableCollection with additional State for Visualization
  *
@@ -45,6 +58,10 @@ struct Sortable
 	{
 	}
 
+	Sortable(int val, SortState sort, AccessState access) noexcept : value{val}, sortState{sort}, accessState{access}
+	{
+	}
+
 	/**
 	 * @brief = operator to assign value, does not change states
 	 *
@@ -142,17 +159,368 @@ concept SortableState =
     std::same_as<T, sortvis::Sortable::AccessState> || std::same_as<T, sortvis::Sortable::SortState>;
 
 /**
- * @brief A Collection of Sortables with additional functionality
+ * @brief auxiliary int array of a SortableCollection, e.g. the buffer of a radix or merge sort,
+ * only accessible through the read & write functions of its collection
+ *
+ */
+class AuxArray
+{
+private:
+	std::vector<int> valuePlane;
+	std::vector<sortvis::Sortable::AccessState> accessPlane;
+	size_t cacheOffset; //! index the CacheSimulator sees for element 0, the aux array lies behind the previous one
+
+	friend class SortableCollection;
+
+public:
+	/**
+	 * @brief Construct a new Aux Array object filled with 0
+	 *
+	 * @param elements number of elements
+	 * @param offset index the CacheSimulator sees for element 0
+	 */
+	AuxArray(size_t elements, size_t offset) :
+	    valuePlane(elements, 0),
+	    accessPlane(elements, sortvis::Sortable::AccessState::None),
+	    cacheOffset{offset}
+	{
+	}
+
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return valuePlane.size();
+	}
+
+	/**
+	 * @return std::span<const int> contiguous view of all values
+	 */
+	[[nodiscard]] std::span<const int> values() const noexcept
+	{
+		return valuePlane;
+	}
+
+	/**
+	 * @brief unchecked element access, the SortState is always None
+	 *
+	 * @param idx index to access
+	 * @return sortvis::Sortable value and AccessState at idx
+	 */
+	[[nodiscard]] sortvis::Sortable operator[](size_t idx) const noexcept
+	{
+		return {valuePlane[idx], sortvis::Sortable::SortState::None, accessPlane[idx]};
+	}
+};
+
+/**
+ * @brief A Collection of Sortables with additional functionality,
+ * values and states are stored in separate copy on write planes,
+ * so copies share all chunks of elements neither of them wrote to since
  *
  */
 class SortableCollection
 {
+public:
+	static constexpr size_t DISTANCE_BUCKETS = 33;
+	static constexpr size_t NO_CURSOR = std::numeric_limits<uint32_t>::max();
+	static constexpr size_t VECTOR_WIDTH = 8; //! pairs of a compareExchange, int32 lanes of an AVX2 register
+	static constexpr size_t MAIN_BUFFER = 0;  //! buffer of the elements for read & write, aux arrays start at 1
+	static constexpr size_t MAX_AUX_ARRAYS = std::numeric_limits<uint8_t>::max();
+
+	using DistanceHistogram = std::array<uint64_t, DISTANCE_BUCKETS>;
+
 private:
-	std::vector<sortvis::Sortable> data;
-	std::array<unsigned, 3> accessCounter{0, 0, 0};
-	std::array<unsigned, 3> sortCounter{0, 0, 0};
+	sortvis::CowPlane<int> valuePlane;
+	sortvis::CowPlane<sortvis::Sortable::SortState> sortPlane;
+	sortvis::CowPlane<sortvis::Sortable::AccessState> accessPlane;
+	std::array<uint64_t, 3> accessCounter{0, 0, 0};
+	std::array<uint64_t, 3> sortCounter{0, 0, 0};
+	uint64_t vectorCounter = 0;
+	uint64_t readCounter = 0;
+	uint64_t writeCounter = 0;
+	uint64_t sequentialLaneCounter = 0; //! lane steps of parallel algorithms that could not run in parallel
+	std::vector<sortvis::AuxArray> auxArrays;
+	size_t auxBytes = 0;     //! bytes of all currently allocated aux arrays
+	size_t peakAuxBytes = 0; //! maximum of auxBytes since the last reset
+	std::array<DistanceHistogram, 3> distanceHistograms{};
+	sortvis::Attachment<sortvis::OperationTrace> trace;
+	sortvis::Attachment<sortvis::CacheSimulator> cache;
+	std::vector<size_t> laneCursors;
+	mutable sortvis::DirtyRanges changed; //! acknowledged through const views by the consumer
+
+	friend class sortvis::Lane;
+
+	/**
+	 * @return the state plane matching STATE
+	 */
+	template<sortvis::SortableState STATE>
+	[[nodiscard]] sortvis::CowPlane<STATE>& plane() noexcept
+	{
+		if constexpr(std::is_same_v<STATE, sortvis::Sortable::SortState>)
+		{
+			return sortPlane;
+		}
+		else
+		{
+			return accessPlane;
+		}
+	}
+
+	/**
+	 * @brief resizes the state planes to the value plane and sets all states to None
+	 *
+	 */
+	void resetStates()
+	{
+		sortPlane.assign(valuePlane.size(), sortvis::Sortable::SortState::None);
+		accessPlane.assign(valuePlane.size(), sortvis::Sortable::AccessState::None);
+		changed.markAll();
+	}
+
+	/**
+	 * @brief sorts values in O(n) with an LSD radix sort of 8 bit digits,
+	 * digits all values share are skipped, so small permutations take a single pass
+	 *
+	 * @param values values to sort
+	 */
+	static void radixSort(std::vector<int>& values)
+	{
+		constexpr uint32_t SIGN = 0x80000000U; // flipping the sign bit orders negative values first
+		constexpr size_t RADIX = 256;
+		std::vector<int> buffer(values.size());
+		for(uint32_t shift = 0; shift < 32; shift += 8)
+		{
+			const auto digit = [shift](int value)
+			{
+				return ((static_cast<uint32_t>(value) ^ SIGN) >> shift) & (RADIX - 1);
+			};
+			std::array<size_t, RADIX> offsets{};
+			for(int value : values)
+			{
+				++offsets[digit(value)];
+			}
+			if(values.empty() || offsets[digit(values.front())] == values.size())
+			{
+				continue;
+			}
+			std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), size_t(0));
+			for(int value : values)
+			{
+				buffer[offsets[digit(value)]++] = value;
+			}
+			values.swap(buffer);
+		}
+	}
+
+	/**
+	 * @brief appends an Operation to the attached OperationTrace if any
+	 *
+	 */
+	void record(sortvis::Operation::Type type, size_t lhs, size_t rhs, uint8_t state = 0)
+	{
+		if(trace)
+		{
+			trace->push({type, state, static_cast<uint32_t>(lhs), static_cast<uint32_t>(rhs)});
+		}
+	}
+
+	/**
+	 * @brief feeds the element accesses of a compare or swap into the attached CacheSimulator if any
+	 *
+	 */
+	void simulateAccess(size_t lhs, size_t rhs) noexcept
+	{
+		if(cache)
+		{
+			cache->access(lhs);
+			cache->access(rhs);
+		}
+	}
+
+	/**
+	 * @return int& writable value of buffer at idx
+	 */
+	[[nodiscard]] int& bufferValue(size_t buffer, size_t idx)
+	{
+		return buffer == MAIN_BUFFER ? valuePlane.writable(idx) : auxArrays[buffer - 1].valuePlane[idx];
+	}
+
+	/**
+	 * @return sortvis::Sortable::AccessState& writable access state of buffer at idx
+	 */
+	[[nodiscard]] sortvis::Sortable::AccessState& bufferAccess(size_t buffer, size_t idx)
+	{
+		return buffer == MAIN_BUFFER ? accessPlane.writable(idx) : auxArrays[buffer - 1].accessPlane[idx];
+	}
+
+	/**
+	 * @brief feeds a read or write of buffer into the attached CacheSimulator if any
+	 *
+	 */
+	void simulateBufferAccess(size_t buffer, size_t idx) noexcept
+	{
+		if(cache)
+		{
+			cache->access(buffer == MAIN_BUFFER ? idx : auxArrays[buffer - 1].cacheOffset + idx);
+		}
+	}
+
+	/**
+	 * @return size_t distance histogram bucket of |lhs - rhs|
+	 */
+	[[nodiscard]] static size_t distanceBucket(size_t lhs, size_t rhs) noexcept
+	{
+		const size_t distance = lhs > rhs ? lhs - rhs : rhs - lhs;
+		const auto width = static_cast<size_t>(std::numeric_limits<size_t>::digits - std::countl_zero(distance));
+		return std::min(width, DISTANCE_BUCKETS - 1);
+	}
+
+	/**
+	 * @brief counts |lhs - rhs| in the distance histogram of state
+	 *
+	 */
+	void countDistance(sortvis::Sortable::AccessState state, size_t lhs, size_t rhs) noexcept
+	{
+		distanceHistograms[static_cast<size_t>(state)][distanceBucket(lhs, rhs)]++;
+	}
+
+	/**
+	 * @brief a single pair of a compareExchange, counted as a compare and a swap if exchanged
+	 *
+	 * @param lhs index receiving the smaller value
+	 * @param rhs index receiving the larger value
+	 * @param opensVector true for the first pair of a vector operation
+	 */
+	void exchange(size_t lhs, size_t rhs, bool opensVector)
+	{
+		record(sortvis::Operation::Type::CompareExchange, lhs, rhs, static_cast<uint8_t>(opensVector));
+		if(opensVector)
+		{
+			++vectorCounter;
+		}
+		accessCounter[static_cast<size_t>(sortvis::Sortable::AccessState::Read)]++;
+		countDistance(sortvis::Sortable::AccessState::Read, lhs, rhs);
+		simulateAccess(lhs, rhs);
+		changed.mark(lhs);
+		changed.mark(rhs);
+		if(valuePlane[rhs] < valuePlane[lhs])
+		{
+			assert(sortPlane[lhs] != sortvis::Sortable::SortState::Full);
+			assert(sortPlane[rhs] != sortvis::Sortable::SortState::Full);
+			accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Write;
+			accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Write;
+			accessCounter[static_cast<size_t>(sortvis::Sortable::AccessState::Write)]++;
+			countDistance(sortvis::Sortable::AccessState::Write, lhs, rhs);
+			std::swap(valuePlane.writable(lhs), valuePlane.writable(rhs));
+		}
+		else
+		{
+			accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Read;
+			accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Read;
+		}
+	}
 
 public:
+	/**
+	 * @brief random access iterator yielding Sortables assembled from the planes
+	 *
+	 */
+	class const_iterator
+	{
+	private:
+		const SortableCollection* collection = nullptr;
+		size_t idx = 0;
+
+	public:
+		using iterator_concept = std::random_access_iterator_tag;
+		using iterator_category = std::input_iterator_tag;
+		using value_type = sortvis::Sortable;
+		using difference_type = std::ptrdiff_t;
+		using reference = sortvis::Sortable;
+
+		const_iterator() noexcept = default;
+
+		const_iterator(const SortableCollection* col, size_t index) noexcept : collection{col}, idx{index}
+		{
+		}
+
+		[[nodiscard]] sortvis::Sortable operator*() const noexcept
+		{
+			return (*collection)[idx];
+		}
+
+		[[nodiscard]] sortvis::Sortable operator[](difference_type offset) const noexcept
+		{
+			return (*collection)[static_cast<size_t>(static_cast<difference_type>(idx) + offset)];
+		}
+
+		const_iterator& operator++() noexcept
+		{
+			++idx;
+			return *this;
+		}
+
+		const_iterator operator++(int) noexcept
+		{
+			const_iterator copy = *this;
+			++idx;
+			return copy;
+		}
+
+		const_iterator& operator--() noexcept
+		{
+			--idx;
+			return *this;
+		}
+
+		const_iterator operator--(int) noexcept
+		{
+			const_iterator copy = *this;
+			--idx;
+			return copy;
+		}
+
+		const_iterator& operator+=(difference_type offset) noexcept
+		{
+			idx = static_cast<size_t>(static_cast<difference_type>(idx) + offset);
+			return *this;
+		}
+
+		const_iterator& operator-=(difference_type offset) noexcept
+		{
+			return *this += -offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator+(const_iterator it, difference_type offset) noexcept
+		{
+			return it += offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator+(difference_type offset, const_iterator it) noexcept
+		{
+			return it += offset;
+		}
+
+		[[nodiscard]] friend const_iterator operator-(const_iterator it, difference_type offset) noexcept
+		{
+			return it -= offset;
+		}
+
+		[[nodiscard]] friend difference_type operator-(const const_iterator& lhs, const const_iterator& rhs) noexcept
+		{
+			return static_cast<difference_type>(lhs.idx) - static_cast<difference_type>(rhs.idx);
+		}
+
+		[[nodiscard]] friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept
+		{
+			return lhs.idx == rhs.idx;
+		}
+
+		[[nodiscard]] friend auto operator<=>(const const_iterator& lhs, const const_iterator& rhs) noexcept
+		{
+			return lhs.idx <=> rhs.idx;
+		}
+	};
+
 	/**
 	 * @brief Construct a new Sortable Collection object
 	 *
@@ -160,13 +528,15 @@ public:
 	 */
 	explicit SortableCollection(size_t elements, bool doRandomize = false)
 	{
-		data.resize(elements);
-		std::iota(data.begin(), data.end(), 1);
+		std::vector<int> values(elements);
+		std::iota(values.begin(), values.end(), 1);
+		valuePlane.assign(values);
+		resetStates();
 		if(doRandomize)
 		{
 			randomize();
 		}
-		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = static_cast<unsigned>(data.size());
+		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = size();
 	}
 
 	/**
@@ -174,14 +544,22 @@ public:
 	 *
 	 * @param elements list of elements to use
 	 */
-	explicit SortableCollection(std::initializer_list<int> elements)
+	explicit SortableCollection(std::initializer_list<int> elements) :
+	    valuePlane(std::span<const int>(elements.begin(), elements.size()))
 	{
-		data.reserve(elements.size());
-		for(int i : elements)
-		{
-			data.emplace_back(i);
-		}
-		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = static_cast<unsigned>(data.size());
+		resetStates();
+		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = size();
+	}
+
+	/**
+	 * @brief Construct a new Sortable Collection object
+	 *
+	 * @param elements elements to copy
+	 */
+	explicit SortableCollection(std::span<const int> elements) : valuePlane(elements)
+	{
+		resetStates();
+		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = size();
 	}
 
 	explicit SortableCollection() = delete;
@@ -198,21 +576,50 @@ public:
 	 */
 	void randomize()
 	{
-		std::default_random_engine rng(std::random_device{}());
-		std::shuffle(data.begin(), data.end(), rng);
+		randomize(sortvis::freshSeed());
 	}
 
 	/**
-	 * @brief Randomize the Collection deterministically,
+	 * @brief Randomize the Collection deterministically to a permutation of its values,
 	 * previous item order does not affect result
 	 *
 	 * @param seed
 	 */
-	void randomize(std::default_random_engine::result_type seed)
+	void randomize(uint64_t seed)
 	{
-		std::default_random_engine rng(seed);
-		std::sort(data.begin(), data.end());
-		std::shuffle(data.begin(), data.end(), rng);
+		std::vector<int> ordered(valuePlane.begin(), valuePlane.end());
+		if(!std::is_sorted(ordered.begin(), ordered.end()))
+		{
+			radixSort(ordered);
+		}
+
+		// a random permutation of [1, size()] picks the rank of each value
+		std::vector<int> values(size());
+		sortvis::generate(values, sortvis::Distribution::Random, seed);
+		for(int& value : values)
+		{
+			value = ordered[static_cast<size_t>(value) - 1];
+		}
+		valuePlane.assign(values);
+		changed.markAll();
+	}
+
+	/**
+	 * @brief replaces all values with generated input,
+	 * previous item order does not affect result
+	 *
+	 * @param distribution shape of the values
+	 * @param seed seed of the generator
+	 * @param parameters parameters of the distribution
+	 * @param pool threads to generate large inputs with, nullptr to generate on the calling thread
+	 */
+	void generate(sortvis::Distribution distribution, uint64_t seed,
+	    const sortvis::DistributionParameters& parameters = {}, sortvis::ThreadPool* pool = nullptr)
+	{
+		std::vector<int> values(size());
+		sortvis::generate(values, distribution, seed, parameters, pool);
+		valuePlane.assign(values);
+		changed.markAll();
 	}
 
 	/**
@@ -223,12 +630,17 @@ public:
 	 * @param rhs right index into data
 	 * @return true if data[lhs] < data[rhs]
 	 */
-	bool less(size_t lhs, size_t rhs) noexcept
+	bool less(size_t lhs, size_t rhs)
 	{
-		data[lhs] = sortvis::Sortable::AccessState::Read;
-		data[rhs] = sortvis::Sortable::AccessState::Read;
+		record(sortvis::Operation::Type::Compare, lhs, rhs);
+		accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Read;
+		accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Read;
+		changed.mark(lhs);
+		changed.mark(rhs);
 		accessCounter[static_cast<size_t>(sortvis::Sortable::AccessState::Read)]++;
-		return data[lhs] < data[rhs];
+		countDistance(sortvis::Sortable::AccessState::Read, lhs, rhs);
+		simulateAccess(lhs, rhs);
+		return valuePlane[lhs] < valuePlane[rhs];
 	}
 
 	/**
@@ -239,41 +651,253 @@ public:
 	 * @param rhs right index into data
 	 * @return true if data[lhs] > data[rhs]
 	 */
-	bool greater(size_t lhs, size_t rhs) noexcept
+	bool greater(size_t lhs, size_t rhs)
 	{
-		data[lhs] = sortvis::Sortable::AccessState::Read;
-		data[rhs] = sortvis::Sortable::AccessState::Read;
+		record(sortvis::Operation::Type::Compare, lhs, rhs);
+		accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Read;
+		accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Read;
+		changed.mark(lhs);
+		changed.mark(rhs);
 		accessCounter[static_cast<size_t>(sortvis::Sortable::AccessState::Read)]++;
-		return data[lhs] > data[rhs];
+		countDistance(sortvis::Sortable::AccessState::Read, lhs, rhs);
+		simulateAccess(lhs, rhs);
+		return valuePlane[lhs] > valuePlane[rhs];
 	}
 
 	/**
-	 * @brief swaps Sortables at indices,
+	 * @brief swaps values at indices,
 	 * sets AccessState of Sortables to Write
 	 *
 	 * @param lhs left index into data
 	 * @param rhs right index into data
 	 */
-	void swap(size_t lhs, size_t rhs) noexcept
+	void swap(size_t lhs, size_t rhs)
 	{
-		assert(data[lhs] != sortvis::Sortable::SortState::Full);
-		assert(data[rhs] != sortvis::Sortable::SortState::Full);
-		data[lhs] = sortvis::Sortable::AccessState::Write;
-		data[rhs] = sortvis::Sortable::AccessState::Write;
+		assert(sortPlane[lhs] != sortvis::Sortable::SortState::Full);
+		assert(sortPlane[rhs] != sortvis::Sortable::SortState::Full);
+		record(sortvis::Operation::Type::Swap, lhs, rhs);
+		accessPlane.writable(lhs) = sortvis::Sortable::AccessState::Write;
+		accessPlane.writable(rhs) = sortvis::Sortable::AccessState::Write;
+		changed.mark(lhs);
+		changed.mark(rhs);
 		accessCounter[static_cast<size_t>(sortvis::Sortable::AccessState::Write)]++;
-		std::swap(data[lhs], data[rhs]);
+		countDistance(sortvis::Sortable::AccessState::Write, lhs, rhs);
+		simulateAccess(lhs, rhs);
+		std::swap(valuePlane.writable(lhs), valuePlane.writable(rhs));
+	}
+
+	/**
+	 * @brief compare-exchange of up to VECTOR_WIDTH pairs as one vector operation,
+	 * afterwards data[lhs[k]] <= data[rhs[k]], exchanged pairs are set to Write, the others to Read,
+	 * counts one vector operation, a compare per pair & a swap per exchanged pair
+	 *
+	 * @param lhs indices receiving the smaller values
+	 * @param rhs indices receiving the larger values, same size as lhs, all indices distinct
+	 */
+	void compareExchange(std::span<const size_t> lhs, std::span<const size_t> rhs)
+	{
+		assert(lhs.size() == rhs.size() && lhs.size() <= VECTOR_WIDTH);
+		for(size_t k = 0; k < lhs.size(); ++k)
+		{
+			exchange(lhs[k], rhs[k], k == 0);
+		}
+	}
+
+	/**
+	 * @brief adds a zero filled aux array, aux arrays have to be released in reverse order
+	 *
+	 * @param elements number of elements
+	 * @return size_t buffer of the aux array for read & write
+	 */
+	size_t allocate(size_t elements)
+	{
+		assert(auxArrays.size() < MAX_AUX_ARRAYS);
+		record(sortvis::Operation::Type::Allocate, elements, 0);
+		const size_t offset = auxArrays.empty() ? size() : auxArrays.back().cacheOffset + auxArrays.back().size();
+		auxArrays.emplace_back(elements, offset);
+		auxBytes += elements * sizeof(int);
+		peakAuxBytes = std::max(peakAuxBytes, auxBytes);
+		return auxArrays.size();
+	}
+
+	/**
+	 * @brief removes the aux array allocated last
+	 *
+	 * @param buffer buffer returned by allocate
+	 */
+	void release(size_t buffer)
+	{
+		assert(buffer == auxArrays.size());
+		record(sortvis::Operation::Type::Release, buffer, 0);
+		auxBytes -= auxArrays.back().size() * sizeof(int);
+		auxArrays.pop_back();
+	}
+
+	/**
+	 * @brief reads an element, sets its AccessState to Read
+	 *
+	 * @param idx index into data
+	 * @return int value at idx
+	 */
+	int read(size_t idx)
+	{
+		return read(MAIN_BUFFER, idx);
 	}
 
-	[[nodiscard]] unsigned getCounter(sortvis::Sortable::AccessState state) const noexcept
+	/**
+	 * @brief reads an element of the elements or an aux array, sets its AccessState to Read
+	 *
+	 * @param buffer MAIN_BUFFER or an aux array from allocate
+	 * @param idx index into buffer
+	 * @return int value at idx
+	 */
+	int read(size_t buffer, size_t idx)
+	{
+		record(sortvis::Operation::Type::Read, idx, 0, static_cast<uint8_t>(buffer));
+		bufferAccess(buffer, idx) = sortvis::Sortable::AccessState::Read;
+		if(buffer == MAIN_BUFFER)
+		{
+			changed.mark(idx);
+		}
+		++readCounter;
+		simulateBufferAccess(buffer, idx);
+		return buffer == MAIN_BUFFER ? valuePlane[idx] : auxArrays[buffer - 1].valuePlane[idx];
+	}
+
+	/**
+	 * @brief overwrites an element, sets its AccessState to Write,
+	 * the algorithm has to make sure the elements end up as a permutation of the initial ones
+	 *
+	 * @param idx index into data
+	 * @param value value to store
+	 */
+	void write(size_t idx, int value)
+	{
+		write(MAIN_BUFFER, idx, value);
+	}
+
+	/**
+	 * @brief overwrites an element of the elements or an aux array, sets its AccessState to Write
+	 *
+	 * @param buffer MAIN_BUFFER or an aux array from allocate
+	 * @param idx index into buffer
+	 * @param value value to store
+	 */
+	void write(size_t buffer, size_t idx, int value)
+	{
+		record(sortvis::Operation::Type::Write, idx, static_cast<uint32_t>(value), static_cast<uint8_t>(buffer));
+		bufferAccess(buffer, idx) = sortvis::Sortable::AccessState::Write;
+		if(buffer == MAIN_BUFFER)
+		{
+			assert(sortPlane[idx] != sortvis::Sortable::SortState::Full);
+			changed.mark(idx);
+		}
+		++writeCounter;
+		simulateBufferAccess(buffer, idx);
+		bufferValue(buffer, idx) = value;
+	}
+
+	/**
+	 * @brief Sets the AccessState of an element of the elements or an aux array
+	 *
+	 * @param buffer MAIN_BUFFER or an aux array from allocate
+	 * @param state state to set
+	 * @param idx index into buffer
+	 */
+	void bufferState(size_t buffer, sortvis::Sortable::AccessState state, size_t idx)
+	{
+		if(buffer == MAIN_BUFFER)
+		{
+			this->state(state, idx);
+			return;
+		}
+		if(trace)
+		{
+			trace->push({sortvis::Operation::Type::AccessState, static_cast<uint8_t>(state),
+			    static_cast<uint32_t>(idx), static_cast<uint32_t>(buffer)});
+		}
+		auxArrays[buffer - 1].accessPlane[idx] = state;
+	}
+
+	/**
+	 * @return std::span<const sortvis::AuxArray> aux arrays in order of allocation, buffer b at index b - 1
+	 */
+	[[nodiscard]] std::span<const sortvis::AuxArray> auxiliaries() const noexcept
+	{
+		return auxArrays;
+	}
+
+	[[nodiscard]] uint64_t getCounter(sortvis::Sortable::AccessState state) const noexcept
 	{
 		return accessCounter[static_cast<size_t>(state)];
 	}
 
-	[[nodiscard]] unsigned getCounter(sortvis::Sortable::SortState state) const noexcept
+	[[nodiscard]] uint64_t getCounter(sortvis::Sortable::SortState state) const noexcept
 	{
 		return sortCounter[static_cast<size_t>(state)];
 	}
 
+	/**
+	 * @return uint64_t number of compareExchange calls, each also counted per pair as compares & swaps
+	 */
+	[[nodiscard]] uint64_t getVectorOps() const noexcept
+	{
+		return vectorCounter;
+	}
+
+	/**
+	 * @return uint64_t number of reads of the elements & aux arrays through read
+	 */
+	[[nodiscard]] uint64_t getReads() const noexcept
+	{
+		return readCounter;
+	}
+
+	/**
+	 * @return uint64_t number of writes to the elements & aux arrays through write
+	 */
+	[[nodiscard]] uint64_t getWrites() const noexcept
+	{
+		return writeCounter;
+	}
+
+	/**
+	 * @return uint64_t number of steps of parallel algorithms whose lanes ran one after another,
+	 * because the lane pool was held by another Sorter or the Sorter itself ran in a ThreadPool task
+	 */
+	[[nodiscard]] uint64_t getSequentialLaneSteps() const noexcept
+	{
+		return sequentialLaneCounter;
+	}
+
+	/**
+	 * @return size_t bytes of the currently allocated aux arrays
+	 */
+	[[nodiscard]] size_t getAuxBytes() const noexcept
+	{
+		return auxBytes;
+	}
+
+	/**
+	 * @return size_t most bytes allocated in aux arrays at the same time since the last reset
+	 */
+	[[nodiscard]] size_t getPeakAuxBytes() const noexcept
+	{
+		return peakAuxBytes;
+	}
+
+	/**
+	 * @brief histogram of the index distance |lhs - rhs| of all compares (Read) or swaps (Write),
+	 * bucket 0 counts distance 0 and bucket b counts distances in [2^(b-1), 2^b)
+	 *
+	 * @param state Read for less & greater, Write for swap
+	 * @return const DistanceHistogram& the histogram
+	 */
+	[[nodiscard]] const DistanceHistogram& getDistances(sortvis::Sortable::AccessState state) const noexcept
+	{
+		return distanceHistograms[static_cast<size_t>(state)];
+	}
+
 	/**
 	 * @brief Sets the AccessState of all Sortables to state,
 	 * if SortState == Full sort counters will be updated
@@ -286,9 +910,18 @@ public:
 	 * @todo have IDX be size_t to reduce instantiations / conversion errors?
 	 */
 	template<sortvis::SortableState STATE, std::unsigned_integral... IDX>
-	void state(STATE state, IDX... idx) noexcept
+	void state(STATE state, IDX... idx)
 	{
-		((data[idx] = state), ...);
+		if(trace)
+		{
+			constexpr auto type = std::is_same_v<STATE, sortvis::Sortable::SortState>
+			                          ? sortvis::Operation::Type::SortState
+			                          : sortvis::Operation::Type::AccessState;
+			(trace->push({type, static_cast<uint8_t>(state), static_cast<uint32_t>(idx)}), ...);
+		}
+		sortvis::CowPlane<STATE>& states = plane<STATE>();
+		((states.writable(idx) = state), ...);
+		(changed.mark(idx), ...);
 		if constexpr(std::is_same_v<STATE, sortvis::Sortable::SortState>)
 		{
 			if(state == sortvis::Sortable::SortState::Full)
@@ -299,41 +932,183 @@ public:
 		}
 	}
 
+	/**
+	 * @brief records all following Operations into operations,
+	 * the attachment is not carried over by copies
+	 *
+	 * @param operations OperationTrace to record into or nullptr to detach
+	 */
+	void attach(sortvis::OperationTrace* operations) noexcept
+	{
+		trace = operations;
+	}
+
+	/**
+	 * @brief feeds the element accesses of all following compares & swaps into simulator,
+	 * the write back of a swap always hits and is not simulated, the attachment is not carried over by copies
+	 *
+	 * @param simulator CacheSimulator to feed or nullptr to detach
+	 */
+	void attach(sortvis::CacheSimulator* simulator) noexcept
+	{
+		cache = simulator;
+	}
+
+	/**
+	 * @brief moves the cursor of a worker lane of a parallel algorithm
+	 *
+	 * @param lane index of the lane
+	 * @param idx index the lane accessed last or NO_CURSOR to hide it
+	 */
+	void cursor(size_t lane, size_t idx)
+	{
+		record(sortvis::Operation::Type::Cursor, lane, idx);
+		if(lane >= laneCursors.size())
+		{
+			laneCursors.resize(lane + 1, NO_CURSOR);
+		}
+		laneCursors[lane] = idx;
+	}
+
+	/**
+	 * @brief counts a step of a parallel algorithm whose lanes ran one after another on the calling thread
+	 *
+	 * @param lanes number of busy lanes of the step
+	 */
+	void sequentialLanes(size_t lanes)
+	{
+		record(sortvis::Operation::Type::SequentialLanes, lanes, 0);
+		++sequentialLaneCounter;
+	}
+
+	/**
+	 * @return std::span<const size_t> cursor of every lane that ran so far, NO_CURSOR if hidden
+	 */
+	[[nodiscard]] std::span<const size_t> cursors() const noexcept
+	{
+		return laneCursors;
+	}
+
+	/**
+	 * @brief replays a recorded Operation, Step & Finish markers are ignored
+	 *
+	 * @param op Operation to replay
+	 */
+	void apply(const sortvis::Operation& op)
+	{
+		switch(op.type)
+		{
+		case sortvis::Operation::Type::Compare:
+			less(op.lhs, op.rhs);
+			break;
+		case sortvis::Operation::Type::Swap:
+			swap(op.lhs, op.rhs);
+			break;
+		case sortvis::Operation::Type::Read:
+			read(op.state, op.lhs);
+			break;
+		case sortvis::Operation::Type::Write:
+			write(op.state, op.lhs, static_cast<int>(op.rhs));
+			break;
+		case sortvis::Operation::Type::Allocate:
+			allocate(op.lhs);
+			break;
+		case sortvis::Operation::Type::Release:
+			release(op.lhs);
+			break;
+		case sortvis::Operation::Type::AccessState:
+			bufferState(op.rhs, static_cast<sortvis::Sortable::AccessState>(op.state), op.lhs);
+			break;
+		case sortvis::Operation::Type::SortState:
+			state(static_cast<sortvis::Sortable::SortState>(op.state), op.lhs);
+			break;
+		case sortvis::Operation::Type::CompareExchange:
+			exchange(op.lhs, op.rhs, op.state != 0);
+			break;
+		case sortvis::Operation::Type::Cursor:
+			cursor(op.lhs, op.rhs);
+			break;
+		case sortvis::Operation::Type::SequentialLanes:
+			sequentialLanes(op.lhs);
+			break;
+		case sortvis::Operation::Type::Step:
+		case sortvis::Operation::Type::Finish:
+			break;
+		}
+	}
+
+	/**
+	 * @return const sortvis::DirtyRanges& indices whose value or state changed since acknowledgeChanges,
+	 * everything after construction, copies & resets
+	 */
+	[[nodiscard]] const sortvis::DirtyRanges& changes() const noexcept
+	{
+		return changed;
+	}
+
+	/**
+	 * @brief forgets all changes, called by the single consumer of changes once it caught up
+	 *
+	 */
+	void acknowledgeChanges() const noexcept
+	{
+		changed.clear();
+	}
+
 	/**
 	 * @return size_t Size of Collection
 	 */
 	[[nodiscard]] size_t size() const noexcept
 	{
-		return data.size();
+		return valuePlane.size();
+	}
+
+	/**
+	 * @return const_iterator to begin of Collection
+	 */
+	[[nodiscard]] const_iterator begin() const noexcept
+	{
+		return {this, 0};
 	}
 
 	/**
-	 * @return std::vector<sortvis::Sortable>::const_iterator to begin of Collection
+	 * @return const_iterator to end of Collection
 	 */
-	[[nodiscard]] std::vector<sortvis::Sortable>::const_iterator begin() const noexcept
+	[[nodiscard]] const_iterator end() const noexcept
 	{
-		return data.cbegin();
+		return {this, size()};
 	}
 
 	/**
-	 * @return std::vector<sortvis::Sortable>::const_iterator to end of Collection
+	 * @return const sortvis::CowPlane<int>& view of all values, chunked & not contiguous
 	 */
-	[[nodiscard]] std::vector<sortvis::Sortable>::const_iterator end() const noexcept
+	[[nodiscard]] const sortvis::CowPlane<int>& values() const noexcept
 	{
-		return data.cend();
+		return valuePlane;
 	}
 
 	/**
-	 * @brief resets the Collection with dat and resets counters
+	 * @brief resets the Collection with dat and resets counters,
+	 * the values are shared with dat until either writes to them
 	 *
 	 * @param dat Collection to copy data from
 	 */
 	void reset(const sortvis::SortableCollection& dat)
 	{
-		data = dat.data;
+		valuePlane = dat.valuePlane;
+		resetStates();
 		accessCounter = {0, 0, 0};
 		sortCounter = {0, 0, 0};
-		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = static_cast<unsigned>(data.size());
+		vectorCounter = 0;
+		readCounter = 0;
+		writeCounter = 0;
+		sequentialLaneCounter = 0;
+		auxArrays.clear();
+		auxBytes = 0;
+		peakAuxBytes = 0;
+		distanceHistograms = {};
+		laneCursors.clear();
+		sortCounter[static_cast<size_t>(sortvis::Sortable::SortState::None)] = size();
 	}
 
 	/**
@@ -344,7 +1119,7 @@ public:
 	 */
 	[[nodiscard]] bool operator!=(const sortvis::SortableCollection& other) const
 	{
-		return data != other.data;
+		return valuePlane != other.valuePlane;
 	}
 
 	/**
@@ -355,18 +1130,18 @@ public:
 	 */
 	[[nodiscard]] bool operator==(const sortvis::SortableCollection& other) const
 	{
-		return data == other.data;
+		return valuePlane == other.valuePlane;
 	}
 
 	/**
 	 * @brief unchecked element access
 	 *
 	 * @param idx index to access
-	 * @return const sortvis::Sortable& element at idx
+	 * @return sortvis::Sortable value and states at idx
 	 */
-	[[nodiscard]] const sortvis::Sortable& operator[](size_t idx) const noexcept
+	[[nodiscard]] sortvis::Sortable operator[](size_t idx) const noexcept
 	{
-		return data[idx];
+		return {valuePlane[idx], sortPlane[idx], accessPlane[idx]};
 	}
 };
 } // namespace sortvis
@@ -1,27 +1,350 @@
 #pragma once
 
 #include "algorithms.hpp"
+#include "generator.hpp"
 #include "sortable.hpp"
+#include "thread-pool.hpp"
 
-#include <cppcoro/generator.hpp>
-
+#include <chrono>
+#include <concepts>
+#include <exception>
 #include <memory>
+#include <span>
+#include <thread>
+#include <utility>
 
 namespace sortvis
 {
+namespace detail
+{
+/**
+ * @brief throws InitFailureException if a freshly started SorterAlgorithm misbehaved
+ *
+ * @param it iterator after the initial resume
+ * @param data SortableCollection the SorterAlgorithm works on
+ * @param datavec SortableCollection the Sorter was constructed with
+ */
+inline void validateInit(const sortvis::Generator<const int>::iterator& it,
+    const sortvis::SortableCollection& data, const sortvis::SortableCollection& datavec)
+{
+	if(it == sortvis::Generator<const int>::sentinel{})
+	{
+		throw sortvis::InitFailureException("Initialization of SorterAlgorithm Failed! Sorter finished early!");
+	}
+	if(*it != sortvis::algorithms::INIT_MAGIC_VALUE)
+	{
+		throw sortvis::InitFailureException(
+		    "Initialization of SorterAlgorithm Failed! Sorter returned unexpected Initial-value!");
+	}
+	if(data != datavec)
+	{
+		throw sortvis::InitFailureException(
+		    "Initialization of SorterAlgorithm Failed! Sorter Data does not match InitialState Data!");
+	}
+}
+} // namespace detail
+
+/**
+ * @brief runs a SorterAlgorithm on its own copy of a SortableCollection in a background thread,
+ * recording every step into an OperationTrace
+ *
+ */
+class TraceProducer
+{
+private:
+	sortvis::OperationTrace operations;
+	std::shared_ptr<sortvis::SortableCollection> colct;
+	sortvis::FrameArena& frames;
+	sortvis::Generator<const int> gen;
+	sortvis::Generator<const int>::iterator it;
+	std::exception_ptr exception;
+	std::jthread worker; //! declared last to be joined before anything else is destroyed
+
+	void run(std::stop_token stop)
+	{
+		sortvis::FrameArena::Scope scope(frames);
+		try
+		{
+			while(operations.waitForConsumer(stop))
+			{
+				++it;
+				const bool last = it == gen.end();
+				operations.endStep(last);
+				if(last)
+				{
+					return;
+				}
+			}
+		}
+		catch(...)
+		{
+			exception = std::current_exception();
+			operations.endStep(true);
+		}
+	}
+
+public:
+	/**
+	 * @brief Construct a new Trace Producer object, runs the SorterAlgorithm up to its first step
+	 *
+	 * @param datavec SortableCollection to sort
+	 * @param algorithm SorterAlgorithm to use to sort
+	 * @param arena FrameArena for the coroutine frames, must outlive the TraceProducer
+	 * @throws InitFailureException if the SorterAlgorithm misbehaved
+	 */
+	TraceProducer(const sortvis::SortableCollection& datavec, sortvis::SorterAlgorithm algorithm,
+	    sortvis::FrameArena& arena) :
+	    colct{std::make_shared<sortvis::SortableCollection>(datavec)},
+	    frames{arena}
+	{
+		sortvis::FrameArena::Scope scope(frames);
+		colct->attach(&operations);
+		gen = algorithm(colct);
+		it = gen.begin();
+		sortvis::detail::validateInit(it, *colct, datavec);
+		operations.endStep(false);
+	}
+
+	TraceProducer(TraceProducer&&) = delete;
+	TraceProducer(const TraceProducer&) = delete;
+	TraceProducer& operator=(TraceProducer&&) = delete;
+	TraceProducer& operator=(const TraceProducer&) = delete;
+	~TraceProducer() = default;
+
+	/**
+	 * @brief starts running the remaining steps in the background
+	 *
+	 */
+	void start()
+	{
+		worker = std::jthread(
+		    [this](std::stop_token stop)
+		    {
+			    run(stop);
+		    });
+	}
+
+	/**
+	 * @return sortvis::OperationTrace& the recorded Operations
+	 */
+	[[nodiscard]] sortvis::OperationTrace& trace() noexcept
+	{
+		return operations;
+	}
+
+	/**
+	 * @brief rethrows the exception of the SorterAlgorithm if there was one,
+	 * only valid after the Finish marker was read
+	 *
+	 */
+	void rethrow() const
+	{
+		if(exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+};
+
 /**
- * @brief A SorterAlgorithm that sorts a SortableCollection
+ * @brief A SorterAlgorithm that sorts a SortableCollection,
+ * a moved-from Sorter counts as finished & can only be assigned to or destroyed
  *
- * @todo add custom copy constructors (defaults break with cppcoro::generator)
+ * @todo add custom copy constructors (defaults break with sortvis::Generator)
  */
 class Sorter
 {
+public:
+	/**
+	 * @brief Direct runs the SorterAlgorithm on the calling thread,
+	 * Traced runs it in the background and replays the recorded Operations
+	 *
+	 */
+	enum class Mode : char
+	{
+		Direct,
+		Traced
+	};
+
+	static constexpr size_t DEFAULT_KEYFRAME_INTERVAL = 256;
+	static constexpr size_t DEFAULT_KEYFRAME_LIMIT = 64;
+	static constexpr size_t NO_LAST_STEP = SIZE_MAX;
+
 private:
 	std::shared_ptr<sortvis::SortableCollection> colct;
-	cppcoro::generator<const int> gen;
-	cppcoro::generator<const int>::iterator it;
-	cppcoro::detail::generator_sentinel end;
+	sortvis::Generator<const int> gen;
+	sortvis::Generator<const int>::iterator it;
+	sortvis::Generator<const int>::sentinel end;
 	sortvis::SorterAlgorithm algorithm;
+	Mode mode;
+	std::unique_ptr<sortvis::TraceProducer> producer;
+
+	/**
+	 * @brief snapshot of the SortableCollection after step,
+	 * replay of the next step starts at Operation cursor
+	 *
+	 */
+	struct Keyframe
+	{
+		size_t step;
+		size_t cursor;
+		sortvis::SortableCollection snapshot;
+
+		Keyframe(size_t keyStep, size_t keyCursor, const sortvis::SortableCollection& data) :
+		    step{keyStep}, cursor{keyCursor}, snapshot{data}
+		{
+		}
+	};
+
+	std::vector<Keyframe> keyframes;
+	size_t keyframeInterval = DEFAULT_KEYFRAME_INTERVAL;
+	size_t keyframeLimit = DEFAULT_KEYFRAME_LIMIT;
+	size_t cursor = 0;
+	size_t frontierCursor = 0;
+	size_t currentStep = 0;
+	size_t frontierStep = 0;
+	std::chrono::steady_clock::duration busy{}; //! wall time spent in advance(steps) since the last start
+	size_t lastStep = NO_LAST_STEP;
+	std::unique_ptr<sortvis::CacheSimulator> cache;
+	//! owns the coroutine frames across resets, declared last to outlive gen & producer on move assignment
+	std::unique_ptr<sortvis::FrameArena> frames = std::make_unique<sortvis::FrameArena>();
+
+	/**
+	 * @brief applies recorded Operations from cursor up to the next Step or Finish marker,
+	 * the marker must already be published
+	 *
+	 * @return true if the marker was a Finish marker
+	 */
+	bool replayOperations()
+	{
+		constexpr size_t chunkSize = sortvis::OperationTrace::CHUNK_SIZE;
+		const sortvis::OperationTrace& operations = producer->trace();
+		const sortvis::OperationTrace::Chunk* chunk = &operations.chunk(cursor / chunkSize);
+		while(true)
+		{
+			const sortvis::Operation& op = (*chunk)[cursor % chunkSize];
+			++cursor;
+			if(op.type == sortvis::Operation::Type::Step)
+			{
+				return false;
+			}
+			if(op.type == sortvis::Operation::Type::Finish)
+			{
+				return true;
+			}
+			colct->apply(op);
+			if(cursor % chunkSize == 0)
+			{
+				chunk = &operations.chunk(cursor / chunkSize);
+			}
+		}
+	}
+
+	/**
+	 * @brief replays the Operations of the next recorded step if available,
+	 * takes a Keyframe every keyframeInterval steps of new ground
+	 *
+	 * @return !hasFinished()
+	 */
+	bool replayStep()
+	{
+		if(currentStep == lastStep)
+		{
+			return false;
+		}
+
+		sortvis::OperationTrace& operations = producer->trace();
+		if(cursor == operations.size())
+		{
+			return true;
+		}
+
+		const bool finished = replayOperations();
+		++currentStep;
+
+		if(cursor > frontierCursor)
+		{
+			frontierCursor = cursor;
+			frontierStep = currentStep;
+			operations.consume(cursor);
+			if(finished)
+			{
+				lastStep = currentStep;
+				producer->rethrow();
+			}
+			if(currentStep % keyframeInterval == 0)
+			{
+				keyframes.emplace_back(currentStep, cursor, *colct);
+				trimKeyframes();
+			}
+		}
+		return currentStep != lastStep;
+	}
+
+	/**
+	 * @brief drops the oldest Keyframes beyond keyframeLimit & releases the Operations only they could replay
+	 *
+	 */
+	void trimKeyframes()
+	{
+		if(keyframes.size() <= keyframeLimit)
+		{
+			return;
+		}
+		keyframes.erase(keyframes.begin(), keyframes.end() - static_cast<std::ptrdiff_t>(keyframeLimit));
+		producer->trace().release(keyframes.front().cursor);
+	}
+
+	/**
+	 * @return true if this Sorter was moved from, its iterator then still names the moved coroutine
+	 */
+	[[nodiscard]] bool movedFrom() const noexcept
+	{
+		return frames == nullptr;
+	}
+
+	/**
+	 * @brief destroys all coroutine frames, they have to go back to the FrameArena before it is destroyed
+	 *
+	 */
+	void releaseFrames() noexcept
+	{
+		producer.reset();
+		gen = {};
+		it = {};
+	}
+
+	/**
+	 * @brief starts the SorterAlgorithm on the current SortableCollection
+	 *
+	 * @param datavec SortableCollection the SorterAlgorithm has to start with
+	 */
+	void start(const sortvis::SortableCollection& datavec)
+	{
+		keyframes.clear();
+		currentStep = 0;
+		frontierStep = 0;
+		busy = {};
+		lastStep = NO_LAST_STEP;
+		releaseFrames();
+		if(mode == Mode::Traced)
+		{
+			cursor = 0;
+			producer = std::make_unique<sortvis::TraceProducer>(datavec, algorithm, *frames);
+			replayOperations();
+			frontierCursor = cursor;
+			producer->trace().consume(cursor);
+			keyframes.emplace_back(0, cursor, *colct);
+			producer->start();
+		}
+		else
+		{
+			sortvis::FrameArena::Scope scope(*frames);
+			gen = algorithm(colct);
+			it = gen.begin();
+			end = gen.end();
+		}
+	}
 
 public:
 	/**
@@ -29,24 +352,25 @@ public:
 	 *
 	 * @param datavec SortableCollection to sort
 	 * @param generator SorterAlgorithm to use to sort
+	 * @param runMode Mode to run the SorterAlgorithm in
 	 */
-	Sorter(const sortvis::SortableCollection& datavec, sortvis::SorterAlgorithm generator) :
-	    colct{std::make_shared<sortvis::SortableCollection>(datavec)}, gen{generator(colct)}, it{gen.begin()},
-	    end{gen.end()}, algorithm{generator}
+	Sorter(const sortvis::SortableCollection& datavec, sortvis::SorterAlgorithm generator,
+	    Mode runMode = Mode::Direct) :
+	    colct{std::make_shared<sortvis::SortableCollection>(datavec)},
+	    algorithm{generator}, mode{runMode}
 	{
-		if(hasFinished())
-		{
-			throw sortvis::InitFailureException("Initialization of SorterAlgorithm Failed! Sorter finished early!");
-		}
-		if(*it != sortvis::algorithms::INIT_MAGIC_VALUE)
+		try
 		{
-			throw sortvis::InitFailureException(
-			    "Initialization of SorterAlgorithm Failed! Sorter returned unexpected Initial-value!");
+			start(datavec);
+			if(mode == Mode::Direct)
+			{
+				sortvis::detail::validateInit(it, *colct, datavec);
+			}
 		}
-		if(*colct != datavec)
+		catch(...)
 		{
-			throw sortvis::InitFailureException(
-			    "Initialization of SorterAlgorithm Failed! Sorter Data does not match InitialState Data!");
+			releaseFrames();
+			throw;
 		}
 	}
 
@@ -55,7 +379,11 @@ public:
 	Sorter(const Sorter&) = delete;
 	Sorter& operator=(Sorter&&) = default;
 	Sorter& operator=(const Sorter&) = delete;
-	~Sorter() = default;
+
+	~Sorter()
+	{
+		releaseFrames();
+	}
 
 	/**
 	 * @brief returns whether the SorterAlgorithm has finished sorting the SortableCollection
@@ -63,24 +391,211 @@ public:
 	 */
 	[[nodiscard]] bool hasFinished() const noexcept
 	{
+		if(movedFrom())
+		{
+			return true;
+		}
+		if(mode == Mode::Traced)
+		{
+			return currentStep == lastStep;
+		}
 		return it == end;
 	}
 
 	/**
-	 * @brief advances the SorterAlgorithm by one step if not finished
+	 * @brief advances the SorterAlgorithm by one step if not finished,
+	 * in Mode::Traced this does nothing while the next step is still being recorded
 	 *
 	 * @return !hasFinished()
 	 */
 	bool advance()
 	{
+		if(movedFrom())
+		{
+			return false;
+		}
+		if(mode == Mode::Traced)
+		{
+			return replayStep();
+		}
 		if(!hasFinished())
 		{
+			sortvis::FrameArena::Scope scope(*frames);
 			++it;
+			++currentStep;
+			frontierStep = currentStep;
 			return !hasFinished();
 		}
 		return false;
 	}
 
+	/**
+	 * @brief advances the SorterAlgorithm by up to steps steps without returning in between,
+	 * in Mode::Traced it stops early at steps that are still being recorded
+	 *
+	 * @param steps maximum number of steps to take
+	 * @return !hasFinished()
+	 */
+	bool advance(size_t steps)
+	{
+		if(movedFrom())
+		{
+			return false;
+		}
+		const auto begin = std::chrono::steady_clock::now();
+		if(mode == Mode::Traced)
+		{
+			for(; steps > 0; --steps)
+			{
+				const size_t previousStep = currentStep;
+				if(!replayStep() || currentStep == previousStep)
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			sortvis::FrameArena::Scope scope(*frames);
+			for(; steps > 0 && it != end; --steps)
+			{
+				++it;
+				++currentStep;
+			}
+			frontierStep = currentStep;
+		}
+		busy += std::chrono::steady_clock::now() - begin;
+		return !hasFinished();
+	}
+
+	/**
+	 * @brief advances the SorterAlgorithm until stop returns true, checked before every step
+	 *
+	 * @tparam PRED std::predicate<const sortvis::Sorter&>
+	 * @param stop called with this Sorter
+	 * @return !hasFinished()
+	 */
+	template<std::predicate<const sortvis::Sorter&> PRED>
+	bool advanceUntil(PRED stop)
+	{
+		while(!stop(std::as_const(*this)))
+		{
+			const size_t previousStep = currentStep;
+			if(!advance() || currentStep == previousStep)
+			{
+				break;
+			}
+		}
+		return !hasFinished();
+	}
+
+	/**
+	 * @brief moves to the state after target steps, in Mode::Traced by restoring the closest
+	 * Keyframe before target and replaying from there, Mode::Direct can only move forward
+	 *
+	 * @param target step to move to
+	 * @return size_t step reached, smaller than target if not yet recorded or finished earlier,
+	 * larger if target is before firstStep()
+	 */
+	size_t seek(size_t target)
+	{
+		if(movedFrom())
+		{
+			return currentStep;
+		}
+		if(mode == Mode::Traced && target < currentStep)
+		{
+			target = std::max(target, keyframes.front().step);
+			auto keyframe = std::prev(std::upper_bound(keyframes.begin(), keyframes.end(), target,
+			    [](size_t step, const Keyframe& key)
+			    {
+				    return step < key.step;
+			    }));
+			*colct = keyframe->snapshot;
+			cursor = keyframe->cursor;
+			currentStep = keyframe->step;
+		}
+		if(currentStep < target)
+		{
+			advance(target - currentStep);
+		}
+		return currentStep;
+	}
+
+	/**
+	 * @brief moves back by one step, only possible in Mode::Traced
+	 *
+	 * @return true if the step was undone
+	 */
+	bool stepBack()
+	{
+		if(mode != Mode::Traced || currentStep <= firstStep())
+		{
+			return false;
+		}
+		const size_t target = currentStep - 1;
+		return seek(target) == target;
+	}
+
+	/**
+	 * @return size_t number of steps taken to reach the current state
+	 */
+	[[nodiscard]] size_t step() const noexcept
+	{
+		return currentStep;
+	}
+
+	/**
+	 * @return size_t earliest step seek can return to, the oldest Keyframe kept in Mode::Traced
+	 */
+	[[nodiscard]] size_t firstStep() const noexcept
+	{
+		return keyframes.empty() ? currentStep : keyframes.front().step;
+	}
+
+	/**
+	 * @return size_t furthest step reached so far, seek can return to any step from firstStep() up to it
+	 */
+	[[nodiscard]] size_t recordedSteps() const noexcept
+	{
+		return frontierStep;
+	}
+
+	/**
+	 * @return std::chrono::steady_clock::duration wall time spent in advance(steps) since the last reset,
+	 * single steps are not timed to keep them cheap
+	 */
+	[[nodiscard]] std::chrono::steady_clock::duration busyTime() const noexcept
+	{
+		return busy;
+	}
+
+	/**
+	 * @brief sets the number of steps between Keyframes taken from now on,
+	 * smaller intervals cost more memory and make seeking backwards faster
+	 *
+	 * @param interval steps between Keyframes, at least 1
+	 */
+	void setKeyframeInterval(size_t interval) noexcept
+	{
+		keyframeInterval = std::max(interval, size_t(1));
+	}
+
+	/**
+	 * @brief sets the number of Keyframes kept, older ones are dropped together with the Operations
+	 * only they could replay, so the history seek can return to spans about limit * interval steps
+	 *
+	 * @param limit Keyframes to keep, at least 1
+	 */
+	void setKeyframeLimit(size_t limit)
+	{
+		keyframeLimit = std::max(limit, size_t(1));
+		if(producer)
+		{
+			trimKeyframes();
+		}
+	}
+
 	/**
 	 * @brief resets the SortableCollection to the dat argument
 	 * and restarts the SorterAlgorithm
@@ -91,12 +606,48 @@ public:
 	bool reset(const sortvis::SortableCollection& dat)
 	{
 		colct->reset(dat);
-		gen = algorithm(colct);
-		it = gen.begin();
-		end = gen.end();
+		if(cache)
+		{
+			cache->reset();
+		}
+		start(dat);
 		return hasFinished();
 	}
 
+	/**
+	 * @brief resets the SortableCollection to the dat argument
+	 * and restarts the SorterAlgorithm in runMode
+	 *
+	 * @param dat SortableCollection to reset to
+	 * @param runMode Mode to run the SorterAlgorithm in
+	 * @return hasFinished()
+	 */
+	bool reset(const sortvis::SortableCollection& dat, Mode runMode)
+	{
+		mode = runMode;
+		return reset(dat);
+	}
+
+	/**
+	 * @brief feeds all following accesses into simulator, reset empties it again,
+	 * in Mode::Traced replaying after seeking backwards is simulated as well
+	 *
+	 * @param simulator CacheSimulator to own or nullptr to stop simulating
+	 */
+	void simulateCache(std::unique_ptr<sortvis::CacheSimulator> simulator) noexcept
+	{
+		cache = std::move(simulator);
+		colct->attach(cache.get());
+	}
+
+	/**
+	 * @return const sortvis::CacheSimulator* simulated cache hierarchy or nullptr if not simulating
+	 */
+	[[nodiscard]] const sortvis::CacheSimulator* cacheSimulator() const noexcept
+	{
+		return cache.get();
+	}
+
 	/**
 	 * @brief returns const& to the SortableCollection
 	 */
@@ -117,9 +668,9 @@ public:
 	 * @brief unchecked element access
 	 *
 	 * @param idx index to access
-	 * @return const sortvis::Sortable& element at idx
+	 * @return sortvis::Sortable value and states at idx
 	 */
-	[[nodiscard]] const sortvis::Sortable& operator[](size_t idx) const noexcept
+	[[nodiscard]] sortvis::Sortable operator[](size_t idx) const noexcept
 	{
 		return (*colct)[idx];
 	}
@@ -134,22 +685,27 @@ class SorterCollection
 private:
 	std::vector<sortvis::Sorter> sorters;
 	sortvis::SortableCollection initialState;
+	std::unique_ptr<sortvis::ThreadPool> pool;
 	bool allFinished = false;
 
 public:
+	static constexpr size_t DEFAULT_BATCH_STEPS = 64;
+
 	/**
 	 * @brief Construct a new Sorter Collection object with n randomized elements
 	 *
 	 * @param elements the number of elements to generate for the Sorters
 	 * @param algorithms a list of SorterAlgorithms for the Sorters to use
+	 * @param mode Mode to run the Sorters in
 	 */
-	SorterCollection(size_t elements, std::initializer_list<sortvis::SorterAlgorithm> algorithms) :
+	SorterCollection(size_t elements, std::span<const sortvis::SorterAlgorithm> algorithms,
+	    sortvis::Sorter::Mode mode = sortvis::Sorter::Mode::Direct) :
 	    initialState(elements)
 	{
 		initialState.randomize();
 		for(sortvis::SorterAlgorithm algo : algorithms)
 		{
-			sorters.emplace_back(initialState, algo);
+			sorters.emplace_back(initialState, algo, mode);
 		}
 	}
 
@@ -158,17 +714,32 @@ public:
 	 *
 	 * @param elements the initial state to use
 	 * @param algorithms a list of SorterAlgorithms for the Sorters to use
+	 * @param mode Mode to run the Sorters in
 	 */
-	SorterCollection(
-	    const sortvis::SortableCollection& elements, std::initializer_list<sortvis::SorterAlgorithm> algorithms) :
+	SorterCollection(const sortvis::SortableCollection& elements,
+	    std::span<const sortvis::SorterAlgorithm> algorithms,
+	    sortvis::Sorter::Mode mode = sortvis::Sorter::Mode::Direct) :
 	    initialState(elements)
 	{
 		for(sortvis::SorterAlgorithm algo : algorithms)
 		{
-			sorters.emplace_back(initialState, algo);
+			sorters.emplace_back(initialState, algo, mode);
 		}
 	}
 
+	SorterCollection(size_t elements, std::initializer_list<sortvis::SorterAlgorithm> algorithms,
+	    sortvis::Sorter::Mode mode = sortvis::Sorter::Mode::Direct) :
+	    SorterCollection(elements, std::span(algorithms.begin(), algorithms.size()), mode)
+	{
+	}
+
+	SorterCollection(const sortvis::SortableCollection& elements,
+	    std::initializer_list<sortvis::SorterAlgorithm> algorithms,
+	    sortvis::Sorter::Mode mode = sortvis::Sorter::Mode::Direct) :
+	    SorterCollection(elements, std::span(algorithms.begin(), algorithms.size()), mode)
+	{
+	}
+
 	/**
 	 * @brief returns true if all Sorters have finished sorting
 	 */
@@ -180,7 +751,8 @@ public:
 	// TODO change return of functions from allHaveFinished to !allHaveFinished?
 
 	/**
-	 * @brief advance all sorters by one step
+	 * @brief advance all sorters by one step on the calling thread,
+	 * a single step is too short to pay for dispatching it to the threads
 	 *
 	 * @return !allHaveFinished()
 	 */
@@ -195,6 +767,111 @@ public:
 		return !allHaveFinished();
 	}
 
+	/**
+	 * @brief advance all sorters by up to steps steps,
+	 * each Sorter takes all its steps in one go, spread over the threads if steps > 1
+	 *
+	 * @param steps maximum number of steps to take
+	 * @return !allHaveFinished()
+	 */
+	bool advance(size_t steps)
+	{
+		bool notFinished = false;
+		if(pool && steps > 1)
+		{
+			pool->run(sorters.size(),
+			    [this, steps](size_t idx)
+			    {
+				    sorters[idx].advance(steps);
+			    });
+			for(const sortvis::Sorter& sorter : sorters)
+			{
+				notFinished |= !sorter.hasFinished();
+			}
+		}
+		else
+		{
+			for(sortvis::Sorter& sorter : sorters)
+			{
+				notFinished |= sorter.advance(steps);
+			}
+		}
+		allFinished = !notFinished;
+		return !allHaveFinished();
+	}
+
+	/**
+	 * @brief advance all sorters in batches of batchSteps until maxSteps were taken
+	 * or stop returns true, stop is checked before every batch
+	 *
+	 * @tparam PRED std::predicate
+	 * @param stop predicate to end advancing early
+	 * @param maxSteps maximum number of steps to take
+	 * @param batchSteps number of steps between checks of stop
+	 * @return !allHaveFinished()
+	 */
+	template<std::predicate PRED>
+	bool advanceUntil(PRED stop, size_t maxSteps, size_t batchSteps = DEFAULT_BATCH_STEPS)
+	{
+		batchSteps = std::max(batchSteps, size_t(1));
+		for(size_t taken = 0; taken < maxSteps && !stop();)
+		{
+			const size_t steps = std::min(batchSteps, maxSteps - taken);
+			taken += steps;
+			if(!advance(steps))
+			{
+				break;
+			}
+		}
+		return !allHaveFinished();
+	}
+
+	/**
+	 * @brief advance all sorters in batches of batchSteps until maxSteps were taken
+	 * or the deadline passed
+	 *
+	 * @param deadline time after which no new batch is started
+	 * @param maxSteps maximum number of steps to take
+	 * @param batchSteps number of steps between checks of the clock
+	 * @return !allHaveFinished()
+	 */
+	bool advanceUntil(
+	    std::chrono::steady_clock::time_point deadline, size_t maxSteps, size_t batchSteps = DEFAULT_BATCH_STEPS)
+	{
+		return advanceUntil(
+		    [deadline]
+		    {
+			    return std::chrono::steady_clock::now() >= deadline;
+		    },
+		    maxSteps, batchSteps);
+	}
+
+	/**
+	 * @brief spreads advance(steps) over threads, every Sorter is advanced by exactly one thread per batch
+	 *
+	 * @param threads number of threads including the calling thread, 0 or 1 advances sequentially
+	 */
+	void setThreads(size_t threads)
+	{
+		if(threads <= 1)
+		{
+			pool.reset();
+		}
+		else if(!pool || pool->size() != threads)
+		{
+			pool.reset();
+			pool = std::make_unique<sortvis::ThreadPool>(threads);
+		}
+	}
+
+	/**
+	 * @return size_t number of threads used by advance
+	 */
+	[[nodiscard]] size_t threads() const noexcept
+	{
+		return pool ? pool->size() : 1;
+	}
+
 	/**
 	 * @brief resets all Sorters with elements
 	 *
@@ -212,6 +889,148 @@ public:
 		return allHaveFinished();
 	}
 
+	/**
+	 * @brief resets all Sorters with elements and switches them to mode
+	 *
+	 * @param elements the new initial state
+	 * @param mode Mode to run the Sorters in
+	 * @return allHaveFinished()
+	 */
+	bool reset(const sortvis::SortableCollection& elements, sortvis::Sorter::Mode mode)
+	{
+		initialState = elements;
+		allFinished = true;
+		for(sortvis::Sorter& sorter : sorters)
+		{
+			allFinished &= sorter.reset(initialState, mode);
+		}
+		return allHaveFinished();
+	}
+
+	/**
+	 * @brief moves all Sorters to the state after target steps,
+	 * Sorters that finished earlier stay at their last step
+	 *
+	 * @param target step to move to
+	 * @return !allHaveFinished()
+	 */
+	bool seek(size_t target)
+	{
+		allFinished = true;
+		for(sortvis::Sorter& sorter : sorters)
+		{
+			sorter.seek(target);
+			allFinished &= sorter.hasFinished();
+		}
+		return !allHaveFinished();
+	}
+
+	/**
+	 * @brief moves all Sorters back to one step before the current step()
+	 *
+	 * @return true if the step was undone
+	 */
+	bool stepBack()
+	{
+		const size_t current = step();
+		if(current <= firstStep())
+		{
+			return false;
+		}
+		seek(current - 1);
+		return true;
+	}
+
+	/**
+	 * @return size_t the largest step() of all Sorters
+	 */
+	[[nodiscard]] size_t step() const noexcept
+	{
+		size_t current = 0;
+		for(const sortvis::Sorter& sorter : sorters)
+		{
+			current = std::max(current, sorter.step());
+		}
+		return current;
+	}
+
+	/**
+	 * @return size_t the largest firstStep() of all Sorters, all of them can seek back to it
+	 */
+	[[nodiscard]] size_t firstStep() const noexcept
+	{
+		size_t first = 0;
+		for(const sortvis::Sorter& sorter : sorters)
+		{
+			first = std::max(first, sorter.firstStep());
+		}
+		return first;
+	}
+
+	/**
+	 * @return size_t the largest recordedSteps() of all Sorters
+	 */
+	[[nodiscard]] size_t recordedSteps() const noexcept
+	{
+		size_t recorded = 0;
+		for(const sortvis::Sorter& sorter : sorters)
+		{
+			recorded = std::max(recorded, sorter.recordedSteps());
+		}
+		return recorded;
+	}
+
+	/**
+	 * @brief gives every Sorter its own copy of prototype to feed all following accesses into
+	 *
+	 * @param prototype CacheSimulator to copy
+	 */
+	void simulateCache(const sortvis::CacheSimulator& prototype)
+	{
+		for(sortvis::Sorter& sorter : sorters)
+		{
+			sorter.simulateCache(std::make_unique<sortvis::CacheSimulator>(prototype));
+		}
+	}
+
+	/**
+	 * @brief stops simulating caches for all Sorters
+	 *
+	 */
+	void stopSimulatingCache() noexcept
+	{
+		for(sortvis::Sorter& sorter : sorters)
+		{
+			sorter.simulateCache(nullptr);
+		}
+	}
+
+	/**
+	 * @brief sets the Keyframe interval of all Sorters
+	 *
+	 * @param interval steps between Keyframes, at least 1
+	 */
+	void setKeyframeInterval(size_t interval) noexcept
+	{
+		for(sortvis::Sorter& sorter : sorters)
+		{
+			sorter.setKeyframeInterval(interval);
+		}
+	}
+
+	/**
+	 * @brief sets the number of Keyframes all Sorters keep
+	 *
+	 * @param limit Keyframes to keep, at least 1
+	 */
+	void setKeyframeLimit(size_t limit)
+	{
+		for(sortvis::Sorter& sorter : sorters)
+		{
+			sorter.setKeyframeLimit(limit);
+		}
+	}
+
 	std::vector<sortvis::Sorter>::const_iterator begin() const noexcept
 	{
 		return sorters.begin();
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sortvis
+{
+/**
+ * @brief fixed set of worker threads that run batches of indexed tasks,
+ * the calling thread takes part in every batch and returns when all tasks are done
+ *
+ */
+class ThreadPool
+{
+private:
+	std::barrier<> startBarrier;
+	std::barrier<> doneBarrier;
+	void (*invoke)(void* task, size_t idx) = nullptr;
+	void* context = nullptr;
+	size_t taskCount = 0;
+	std::atomic<size_t> nextTask{0};
+	std::mutex exceptionMutex;
+	std::exception_ptr exception;
+	bool stopping = false;
+	std::vector<std::jthread> workers; //! declared last to be joined before anything else is destroyed
+
+	static inline thread_local bool working = false;
+
+	/**
+	 * @brief runs tasks of the current batch until none are left
+	 *
+	 */
+	void work() noexcept
+	{
+		const bool outer = std::exchange(working, true);
+		for(size_t idx = nextTask++; idx < taskCount; idx = nextTask++)
+		{
+			try
+			{
+				invoke(context, idx);
+			}
+			catch(...)
+			{
+				std::lock_guard lock(exceptionMutex);
+				if(!exception)
+				{
+					exception = std::current_exception();
+				}
+			}
+		}
+		working = outer;
+	}
+
+public:
+	/**
+	 * @brief Construct a new Thread Pool object
+	 *
+	 * @param threads number of threads working on a batch including the calling thread, at least 1
+	 */
+	explicit ThreadPool(size_t threads) :
+	    startBarrier{static_cast<std::ptrdiff_t>(std::max(threads, size_t(1)))},
+	    doneBarrier{static_cast<std::ptrdiff_t>(std::max(threads, size_t(1)))}
+	{
+		for(size_t i = 1; i < threads; ++i)
+		{
+			workers.emplace_back(
+			    [this]
+			    {
+				    while(true)
+				    {
+					    startBarrier.arrive_and_wait();
+					    if(stopping)
+					    {
+						    return;
+					    }
+					    work();
+					    doneBarrier.arrive_and_wait();
+				    }
+			    });
+		}
+	}
+
+	ThreadPool() = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(ThreadPool&&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	~ThreadPool()
+	{
+		stopping = true;
+		startBarrier.arrive_and_wait();
+	}
+
+	/**
+	 * @brief calls task(idx) for every idx in [0, count) spread over all threads
+	 *
+	 * @tparam TASK invocable with size_t
+	 * @param count number of tasks
+	 * @param task the task to run
+	 * @throws the first exception thrown by any task after all tasks finished
+	 */
+	template<typename TASK>
+	void run(size_t count, TASK&& task)
+	{
+		invoke = [](void* ctx, size_t idx)
+		{
+			(*static_cast<std::remove_reference_t<TASK>*>(ctx))(idx);
+		};
+		context = const_cast<void*>(static_cast<const void*>(std::addressof(task)));
+		taskCount = count;
+		nextTask = 0;
+
+		startBarrier.arrive_and_wait();
+		work();
+		doneBarrier.arrive_and_wait();
+
+		if(exception)
+		{
+			std::exception_ptr thrown = std::exchange(exception, nullptr);
+			std::rethrow_exception(thrown);
+		}
+	}
+
+	/**
+	 * @return true if called from a task of any ThreadPool, starting more threads there oversubscribes the cores
+	 */
+	[[nodiscard]] static bool insideTask() noexcept
+	{
+		return working;
+	}
+
+	/**
+	 * @return size_t number of threads working on a batch including the calling thread
+	 */
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return workers.size() + 1;
+	}
+};
+} // namespace sortvis
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <vector>
+
+namespace sortvis
+{
+/**
+ * @brief non owning pointer to a per instance observer,
+ * copies start detached and assignments keep the current target
+ *
+ * @tparam T observer type
+ */
+template<typename T>
+class Attachment
+{
+private:
+	T* target = nullptr;
+
+public:
+	Attachment() noexcept = default;
+
+	Attachment(const Attachment&) noexcept
+	{
+	}
+
+	Attachment(Attachment&&) noexcept
+	{
+	}
+
+	Attachment& operator=(const Attachment&) noexcept
+	{
+		return *this;
+	}
+
+	Attachment& operator=(Attachment&&) noexcept
+	{
+		return *this;
+	}
+
+	~Attachment() = default;
+
+	Attachment& operator=(T* other) noexcept
+	{
+		target = other;
+		return *this;
+	}
+
+	[[nodiscard]] T* operator->() const noexcept
+	{
+		return target;
+	}
+
+	[[nodiscard]] explicit operator bool() const noexcept
+	{
+		return target != nullptr;
+	}
+};
+
+/**
+ * @brief a single recorded operation on a SortableCollection
+ *
+ */
+struct Operation
+{
+	/**
+	 * @brief Compare/Swap use lhs & rhs, AccessState/SortState set state at lhs (AccessState of buffer rhs),
+	 * CompareExchange orders lhs & rhs with state 1 on the first pair of a vector operation,
+	 * Read/Write access index lhs of buffer state, Write stores rhs, Allocate adds an aux array of lhs elements,
+	 * Release removes aux array lhs, Cursor moves the cursor of lane lhs to rhs,
+	 * SequentialLanes counts a step of lhs busy lanes that ran one after another on the calling thread,
+	 * Step ends a SorterAlgorithm step, Finish ends the last step
+	 *
+	 */
+	enum class Type : uint8_t
+	{
+		Compare,
+		Swap,
+		CompareExchange,
+		Read,
+		Write,
+		Allocate,
+		Release,
+		AccessState,
+		SortState,
+		Cursor,
+		SequentialLanes,
+		Step,
+		Finish
+	} type = Type::Step;
+
+	uint8_t state = 0;
+	uint32_t lhs = 0;
+	uint32_t rhs = 0;
+};
+
+/**
+ * @brief chunked log of Operations written by one producer and read by one consumer,
+ * Operations become visible to the consumer at the end of each step,
+ * it holds the Operations from the last release up to LOOK_AHEAD Operations past the consumer
+ *
+ */
+class OperationTrace
+{
+public:
+	static constexpr size_t CHUNK_SIZE = 4096;
+	static constexpr size_t LOOK_AHEAD = size_t(1) << 20;
+
+	using Chunk = std::array<sortvis::Operation, CHUNK_SIZE>;
+
+private:
+	std::deque<std::unique_ptr<Chunk>> chunks;
+	size_t releasedChunks = 0; //! chunks freed from the front of chunks
+	mutable std::mutex chunkMutex;
+	Chunk* current = nullptr;
+	size_t written = 0;
+
+	std::atomic<size_t> published{0};
+	std::atomic<size_t> consumed{0};
+	std::atomic<bool> waiting{false};
+	std::mutex waitMutex;
+	std::condition_variable_any waitCondition;
+
+public:
+	OperationTrace() = default;
+	OperationTrace(OperationTrace&&) = delete;
+	OperationTrace(const OperationTrace&) = delete;
+	OperationTrace& operator=(OperationTrace&&) = delete;
+	OperationTrace& operator=(const OperationTrace&) = delete;
+	~OperationTrace() = default;
+
+	/**
+	 * @brief appends op, not visible to the consumer until the step ends
+	 *
+	 * @param op Operation to append
+	 */
+	void push(sortvis::Operation op)
+	{
+		if(written % CHUNK_SIZE == 0)
+		{
+			std::lock_guard lock(chunkMutex);
+			current = chunks.emplace_back(std::make_unique<Chunk>()).get();
+		}
+		(*current)[written % CHUNK_SIZE] = op;
+		++written;
+	}
+
+	/**
+	 * @brief appends a Step or Finish marker and publishes all Operations
+	 *
+	 * @param last true if this was the last step
+	 */
+	void endStep(bool last)
+	{
+		push({last ? sortvis::Operation::Type::Finish : sortvis::Operation::Type::Step});
+		published.store(written, std::memory_order_release);
+	}
+
+	/**
+	 * @brief blocks the producer while it is LOOK_AHEAD Operations ahead of the consumer
+	 *
+	 * @param stop token to interrupt waiting
+	 * @return false if stop was requested
+	 */
+	bool waitForConsumer(std::stop_token stop)
+	{
+		if(written - consumed.load(std::memory_order_acquire) <= LOOK_AHEAD)
+		{
+			return !stop.stop_requested();
+		}
+		std::unique_lock lock(waitMutex);
+		waiting.store(true);
+		const bool ready = waitCondition.wait(lock, stop,
+		    [this]
+		    {
+			    return written - consumed.load() <= LOOK_AHEAD;
+		    });
+		waiting.store(false);
+		return ready;
+	}
+
+	/**
+	 * @brief marks all Operations before idx as consumed, may wake the producer
+	 *
+	 * @param idx index of the next Operation the consumer will read
+	 */
+	void consume(size_t idx)
+	{
+		consumed.store(idx);
+		if(waiting.load())
+		{
+			{
+				std::lock_guard lock(waitMutex);
+			}
+			waitCondition.notify_one();
+		}
+	}
+
+	/**
+	 * @brief frees the chunks that only hold Operations before idx, they must not be accessed anymore
+	 *
+	 * @param idx index of the first Operation the consumer may still read, at most size()
+	 */
+	void release(size_t idx)
+	{
+		std::lock_guard lock(chunkMutex);
+		for(; releasedChunks < idx / CHUNK_SIZE; ++releasedChunks)
+		{
+			chunks.pop_front();
+		}
+	}
+
+	/**
+	 * @return size_t number of Operations visible to the consumer
+	 */
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return published.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * @brief access to a chunk of published Operations that was not released,
+	 * the chunk holds Operations [chunkIdx * CHUNK_SIZE, (chunkIdx + 1) * CHUNK_SIZE)
+	 *
+	 * @param chunkIdx index of the chunk
+	 * @return const Chunk& the chunk
+	 */
+	[[nodiscard]] const Chunk& chunk(size_t chunkIdx) const
+	{
+		std::lock_guard lock(chunkMutex);
+		return *chunks[chunkIdx - releasedChunks];
+	}
+
+	/**
+	 * @return size_t number of chunks currently held
+	 */
+	[[nodiscard]] size_t heldChunks() const
+	{
+		std::lock_guard lock(chunkMutex);
+		return chunks.size();
+	}
+};
+} // namespace sortvis
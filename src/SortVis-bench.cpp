@@ -0,0 +1,487 @@
+#include "registry.hpp"
+#include "sorter.hpp"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <Windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+constexpr uint64_t SEED = 73195;
+constexpr size_t DEFAULT_MAX_STEPS = 50'000'000;
+
+constexpr std::array<size_t, 4> SIZES{1'000, 10'000, 100'000, 1'000'000};
+
+/**
+ * @brief measurements of a single Sorter run
+ *
+ */
+struct Result
+{
+	size_t steps = 0;
+	double seconds = 0;
+	double nativeSeconds = 0;
+	double nativeVsQuick = 0; //! nativeSeconds / nativeSeconds of quick sort on the same input, 0 if unknown
+	uint64_t compares = 0;
+	uint64_t swaps = 0;
+	uint64_t vectorOps = 0;
+	uint64_t reads = 0;
+	uint64_t writes = 0;
+	size_t peakAuxBytes = 0;
+	double meanDistanceLog2 = 0;
+	size_t peakRSS = 0;                //! since resetPeakResident() at the start of the run if that succeeded
+	std::vector<uint64_t> cacheHits;   //! per simulated cache level, empty if not simulated
+	std::vector<uint64_t> cacheMisses; //! per simulated cache level, empty if not simulated
+	bool truncated = false;
+};
+
+/**
+ * @brief restarts the peak resident set size measured by peakResidentBytes() at the current resident set size
+ *
+ * @return bool false if the platform can't reset it, peakResidentBytes() then is the peak of the whole process
+ */
+bool resetPeakResident()
+{
+#if defined(__linux__)
+	std::ofstream clearRefs("/proc/self/clear_refs");
+	clearRefs << '5';
+	clearRefs.flush();
+	return clearRefs.good();
+#else
+	return false;
+#endif
+}
+
+/**
+ * @return size_t peak resident set size of this process in bytes
+ */
+size_t peakResidentBytes()
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters{};
+	if(GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)) == 0)
+	{
+		return 0;
+	}
+	return counters.PeakWorkingSetSize;
+#else
+#if defined(__linux__)
+	// unlike ru_maxrss VmHWM restarts with resetPeakResident()
+	std::ifstream status("/proc/self/status");
+	for(std::string line; std::getline(status, line);)
+	{
+		if(line.starts_with("VmHWM:"))
+		{
+			return std::strtoull(line.c_str() + 6, nullptr, 10) * 1024;
+		}
+	}
+#endif
+	rusage usage{};
+	if(getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return 0;
+	}
+#if defined(__APPLE__)
+	return static_cast<size_t>(usage.ru_maxrss);
+#else
+	return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+/**
+ * @brief parses a whole unsigned decimal number
+ *
+ * @return bool false if text is no number
+ */
+bool parseCount(std::string_view text, size_t& count) noexcept
+{
+	const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), count);
+	return error == std::errc() && end == text.data() + text.size();
+}
+
+/**
+ * @brief average of the log2 distance buckets over all compares & swaps,
+ * 0 means neighbouring accesses and each +1 doubles the typical distance
+ *
+ * @param data SortableCollection with distance histograms
+ * @return double mean bucket index
+ */
+double meanDistanceLog2(const sortvis::SortableCollection& data) noexcept
+{
+	double weighted = 0;
+	double total = 0;
+	using AccessState = sortvis::Sortable::AccessState;
+	for(AccessState state : {AccessState::Read, AccessState::Write})
+	{
+		const sortvis::SortableCollection::DistanceHistogram& histogram = data.getDistances(state);
+		for(size_t bucket = 0; bucket < histogram.size(); ++bucket)
+		{
+			weighted += static_cast<double>(bucket) * static_cast<double>(histogram[bucket]);
+			total += static_cast<double>(histogram[bucket]);
+		}
+	}
+	return total == 0 ? 0.0 : weighted / total;
+}
+
+/**
+ * @brief drives a Sorter until it finished or maxSteps were taken
+ *
+ * @param info registered algorithm to measure
+ * @param elements number of elements to sort
+ * @param maxSteps upper limit of advance() calls
+ * @param simulateCache feed all accesses into a typical CacheSimulator, slows down the run
+ * @param input Distribution of the unsorted elements
+ * @param pool threads to generate the input with
+ * @return Result measurements of the run
+ */
+Result measure(const sortvis::AlgorithmInfo& info, size_t elements, size_t maxSteps, bool simulateCache,
+    sortvis::Distribution input, sortvis::ThreadPool& pool)
+{
+	resetPeakResident();
+	sortvis::SortableCollection sortables(elements);
+	sortables.generate(input, SEED, {}, &pool);
+	sortvis::Sorter sorter(sortables, info.algorithm);
+	if(simulateCache)
+	{
+		sorter.simulateCache(std::make_unique<sortvis::CacheSimulator>(sortvis::CacheSimulator::typical()));
+	}
+
+	Result result;
+
+	const auto start = std::chrono::steady_clock::now();
+	while(!sorter.hasFinished() && result.steps < maxSteps)
+	{
+		sorter.advance();
+		++result.steps;
+	}
+	const auto stop = std::chrono::steady_clock::now();
+
+	result.seconds = std::chrono::duration<double>(stop - start).count();
+	result.compares = sorter.data().getCounter(sortvis::Sortable::AccessState::Read);
+	result.swaps = sorter.data().getCounter(sortvis::Sortable::AccessState::Write);
+	result.vectorOps = sorter.data().getVectorOps();
+	result.reads = sorter.data().getReads();
+	result.writes = sorter.data().getWrites();
+	result.peakAuxBytes = sorter.data().getPeakAuxBytes();
+	result.meanDistanceLog2 = meanDistanceLog2(sorter.data());
+	result.peakRSS = peakResidentBytes();
+	result.truncated = !sorter.hasFinished();
+	if(const sortvis::CacheSimulator* cache = sorter.cacheSimulator())
+	{
+		for(const sortvis::CacheLevel& level : cache->levels())
+		{
+			result.cacheHits.push_back(level.hits());
+			result.cacheMisses.push_back(level.misses());
+		}
+	}
+
+	if(!result.truncated && info.native != nullptr)
+	{
+		std::vector<int> values(sortables.values().begin(), sortables.values().end());
+		const auto nativeStart = std::chrono::steady_clock::now();
+		info.native(values);
+		const auto nativeStop = std::chrono::steady_clock::now();
+		result.nativeSeconds = std::chrono::duration<double>(nativeStop - nativeStart).count();
+
+		if(!std::is_sorted(values.begin(), values.end()))
+		{
+			throw std::runtime_error("native algorithm did not sort");
+		}
+	}
+	return result;
+}
+
+constexpr int NAME_WIDTH = 30;
+constexpr int CELL_WIDTH = 16;
+
+/**
+ * @brief prints one metric of all results as algorithm x size matrix
+ *
+ * @param title name of the metric
+ * @param algorithms measured algorithms
+ * @param results results indexed [size][algorithm]
+ * @param metric function extracting the metric from a Result
+ */
+template<typename METRIC>
+void printMatrix(const char* title, const std::vector<sortvis::AlgorithmInfo>& algorithms,
+    const std::array<std::vector<Result>, SIZES.size()>& results, METRIC metric)
+{
+	std::cout << '\n' << std::left << std::setw(NAME_WIDTH) << title << std::right;
+	for(size_t elements : SIZES)
+	{
+		std::cout << std::setw(CELL_WIDTH) << elements;
+	}
+	std::cout << '\n';
+
+	for(size_t algo = 0; algo < algorithms.size(); ++algo)
+	{
+		std::cout << std::left << std::setw(NAME_WIDTH) << algorithms[algo].name << std::right;
+		for(size_t size = 0; size < SIZES.size(); ++size)
+		{
+			const Result& result = results[size][algo];
+			std::cout << std::setw(CELL_WIDTH - 1) << metric(result) << (result.truncated ? '*' : ' ');
+		}
+		std::cout << '\n';
+	}
+}
+
+/**
+ * @brief prints the registered metadata of all algorithms
+ *
+ */
+void printAlgorithms(const std::vector<sortvis::AlgorithmInfo>& algorithms)
+{
+	std::cout << '\n' << std::left << std::setw(NAME_WIDTH) << "algorithm" << std::right << std::setw(CELL_WIDTH)
+	          << "stable" << std::setw(CELL_WIDTH) << "aux memory" << std::setw(CELL_WIDTH) << "max N"
+	          << std::setw(CELL_WIDTH) << "native" << '\n';
+	for(const sortvis::AlgorithmInfo& info : algorithms)
+	{
+		std::cout << std::left << std::setw(NAME_WIDTH) << info.name << std::right << std::setw(CELL_WIDTH)
+		          << (info.stable ? "yes" : "no") << std::setw(CELL_WIDTH) << sortvis::getAuxMemoryName(info.auxMemory)
+		          << std::setw(CELL_WIDTH) << info.maxElements << std::setw(CELL_WIDTH)
+		          << (info.native != nullptr ? "yes" : "no") << '\n';
+	}
+}
+} // namespace
+
+/**
+ * @brief windowless benchmark of all SorterAlgorithms
+ *
+ * usage: SortVis-bench [--max-steps N] [--cache] [--lanes N] [--lane-batch N] [--scalar] [--input NAME]
+ * [--plugins DIR]
+ * --cache adds simulated cache hits & misses, timings then include the simulation
+ * --lanes sets the worker threads of the parallel algorithms, default all hardware threads
+ * --lane-batch sets the operations each worker thread takes per step, default DEFAULT_PARALLEL_BATCH
+ * --scalar runs the native vectorized algorithms with their scalar fallback
+ * --input selects the Distribution of the unsorted elements by name, default random
+ * --plugins loads the algorithm plugins of DIR in addition to the built in algorithms, default plugins
+ * peak RSS is measured per run where the peak can be reset (Linux), otherwise it is the process peak so far
+ */
+int main(int argc, char** argv)
+{
+	size_t maxSteps = DEFAULT_MAX_STEPS;
+	bool simulateCache = false;
+	sortvis::Distribution input = sortvis::Distribution::Random;
+	std::filesystem::path pluginDirectory = sortvis::PLUGIN_DIRECTORY;
+	const auto printUsage = [argv]()
+	{
+		std::cerr << "usage: " << argv[0]
+		          << " [--max-steps N] [--cache] [--lanes N] [--lane-batch N] [--scalar] [--input NAME] [--plugins DIR]"
+		          << std::endl;
+		return EXIT_FAILURE;
+	};
+	for(int i = 1; i < argc; ++i)
+	{
+		const std::string_view arg(argv[i]);
+		const bool hasValue = i + 1 < argc;
+		if((arg == "--max-steps" || arg == "--lanes" || arg == "--lane-batch") && hasValue)
+		{
+			size_t count = 0;
+			if(!parseCount(argv[++i], count))
+			{
+				std::cerr << arg << " expects a number instead of \"" << argv[i] << '"' << std::endl;
+				return printUsage();
+			}
+			if(arg == "--max-steps")
+			{
+				maxSteps = count;
+			}
+			else if(arg == "--lanes")
+			{
+				sortvis::algorithms::setParallelLanes(count);
+			}
+			else
+			{
+				sortvis::algorithms::setParallelBatch(count);
+			}
+		}
+		else if(arg == "--cache")
+		{
+			simulateCache = true;
+		}
+		else if(arg == "--scalar")
+		{
+			sortvis::algorithms::setVectorKernels(false);
+		}
+		else if(arg == "--input" && hasValue)
+		{
+			const std::string_view name(argv[++i]);
+			const auto* found = std::find_if(sortvis::DISTRIBUTIONS.begin(), sortvis::DISTRIBUTIONS.end(),
+			    [name](sortvis::Distribution distribution)
+			    {
+				    return name == sortvis::getDistributionName(distribution);
+			    });
+			if(found == sortvis::DISTRIBUTIONS.end())
+			{
+				std::cerr << "unknown input " << name << ", one of:";
+				for(sortvis::Distribution distribution : sortvis::DISTRIBUTIONS)
+				{
+					std::cerr << " \"" << sortvis::getDistributionName(distribution) << '"';
+				}
+				std::cerr << std::endl;
+				return EXIT_FAILURE;
+			}
+			input = *found;
+		}
+		else if(arg == "--plugins" && hasValue)
+		{
+			pluginDirectory = argv[++i];
+		}
+		else
+		{
+			return printUsage();
+		}
+	}
+
+	try
+	{
+		try
+		{
+			sortvis::loadPlugins(pluginDirectory);
+		}
+		catch(sortvis::PluginException& e)
+		{
+			std::cerr << "[PluginException] " << e.what() << std::endl;
+		}
+		const std::vector<sortvis::AlgorithmInfo> algorithms = sortvis::registeredAlgorithms();
+		std::array<std::vector<Result>, SIZES.size()> results;
+		sortvis::ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1U));
+		const bool cellPeaks = resetPeakResident(); // otherwise each cell repeats the largest earlier one
+
+		for(size_t size = 0; size < SIZES.size(); ++size)
+		{
+			for(const sortvis::AlgorithmInfo& info : algorithms)
+			{
+				std::cerr << "running " << info.name << " on " << SIZES[size] << " elements" << std::endl;
+				results[size].push_back(measure(info, SIZES[size], maxSteps, simulateCache, input, pool));
+			}
+
+			const auto quick = std::find_if(algorithms.begin(), algorithms.end(),
+			    [](const sortvis::AlgorithmInfo& info)
+			    {
+				    return info.algorithm == sortvis::algorithms::quick;
+			    });
+			const double quickSeconds = results[size][static_cast<size_t>(quick - algorithms.begin())].nativeSeconds;
+			for(Result& result : results[size])
+			{
+				result.nativeVsQuick = quickSeconds == 0 ? 0.0 : result.nativeSeconds / quickSeconds;
+			}
+		}
+
+		std::cout << "input: " << sortvis::getDistributionName(input) << '\n';
+		std::cout << "native kernels: " << (sortvis::algorithms::vectorKernels() ? "AVX2" : "scalar") << '\n';
+		printAlgorithms(algorithms);
+		std::cout << std::fixed << std::setprecision(2);
+
+		printMatrix("ns/co_yield", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.steps == 0 ? 0.0 : r.seconds * 1e9 / static_cast<double>(r.steps);
+		    });
+		printMatrix("steps/s", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.seconds == 0 ? 0.0 : static_cast<double>(r.steps) / r.seconds;
+		    });
+		printMatrix("native [ms]", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.nativeSeconds * 1e3;
+		    });
+		printMatrix("native / quick", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.nativeVsQuick;
+		    });
+		printMatrix("compares", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.compares;
+		    });
+		printMatrix("swaps", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.swaps;
+		    });
+		printMatrix("reads", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.reads;
+		    });
+		printMatrix("writes", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.writes;
+		    });
+		printMatrix("peak aux [KiB]", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return static_cast<double>(r.peakAuxBytes) / 1024.0;
+		    });
+		printMatrix("vector ops", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.vectorOps;
+		    });
+		printMatrix("log2 distance", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return r.meanDistanceLog2;
+		    });
+		if(simulateCache)
+		{
+			const sortvis::CacheSimulator typical = sortvis::CacheSimulator::typical();
+			for(size_t level = 0; level < typical.levels().size(); ++level)
+			{
+				const std::string name = typical.levels()[level].name();
+				printMatrix((name + " hits").c_str(), algorithms, results,
+				    [level](const Result& r)
+				    {
+					    return r.cacheHits[level];
+				    });
+				printMatrix((name + " misses").c_str(), algorithms, results,
+				    [level](const Result& r)
+				    {
+					    return r.cacheMisses[level];
+				    });
+			}
+		}
+		printMatrix(cellPeaks ? "peak RSS [MiB]" : "process peak RSS [MiB]", algorithms, results,
+		    [](const Result& r)
+		    {
+			    return static_cast<double>(r.peakRSS) / (1024.0 * 1024.0);
+		    });
+
+		std::cout << "\n* stopped after " << maxSteps << " steps\n";
+	}
+	catch(sortvis::InitFailureException& e)
+	{
+		std::cerr << "[InitFailureException] " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	catch(std::exception& e)
+	{
+		std::cerr << "[StdException] " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
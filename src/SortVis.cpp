@@ -1,4 +1,5 @@
 #include "gui.hpp"
+#include "headless.hpp"
 
 #include <imgui-SFML.h>
 
@@ -7,8 +8,17 @@
 
 #include <iostream>
 
-int main()
+/**
+ * @brief opens the visualization, any argument runs the headless mode instead
+ *
+ */
+int main(int argc, char** argv)
 {
+	if(argc > 1)
+	{
+		return sortvis::headless::main(std::span(argv, static_cast<size_t>(argc)));
+	}
+
 	try
 	{
 		sf::VideoMode windowvidmode = sf::VideoMode::getDesktopMode();
@@ -23,6 +33,15 @@ int main()
 		ImPlot::CreateContext();
 		ImGui::GetIO().IniFilename = nullptr;
 
+		try
+		{
+			sortvis::loadPlugins(sortvis::PLUGIN_DIRECTORY);
+		}
+		catch(sortvis::PluginException& e)
+		{
+			std::cerr << "[PluginException] " << e.what() << std::endl;
+		}
+
 		sortvis::GUIData data;
 
 		while(window.isOpen())
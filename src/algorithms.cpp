@@ -1,228 +1,513 @@
+#include "simd.hpp"
 #include "sorter.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
 
 namespace sortvis::algorithms
 {
-cppcoro::generator<const int> bubble(std::shared_ptr<sortvis::SortableCollection> data)
+namespace detail
+{
+size_t iParent(size_t i)
+{
+	return (i - 1) / 2;
+}
+size_t iLeftChild(size_t i)
 {
-	bool changed = false;
-	size_t n = data->size();
+	return (2 * i) + 1;
+}
 
-	co_yield INIT_MAGIC_VALUE;
+constexpr size_t MERGE_BLOCK = 16;
 
-	do
-	{
-		--n;
-		changed = false;
-		for(size_t i = 0; i < n; ++i)
-		{
-			bool isLess = data->less(i + 1, i);
-			co_yield COMP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, i, i + 1);
+/**
+ * @brief range of a top down merge sort, split ranges are merged once both halves are sorted
+ *
+ */
+struct MergeFrame
+{
+	size_t first;
+	size_t last;
+	bool split;
+};
+
+constexpr size_t INTRO_CUTOFF = 16;
+constexpr size_t PDQ_INSERTION = 24;
+constexpr size_t PDQ_NINTHER = 128;
+constexpr size_t PDQ_PARTIAL_LIMIT = 8;
+constexpr size_t TIM_MIN_MERGE = 64;
+constexpr size_t TIM_MIN_GALLOP = 7;
 
-			if(isLess)
-			{
-				data->swap(i + 1, i);
-				co_yield SWAP_MAGIC_VALUE;
-				data->state(sortvis::Sortable::AccessState::None, i, i + 1);
+/**
+ * @return size_t floor(log2(n)), 0 for n = 0
+ */
+size_t floorLog2(size_t n) noexcept
+{
+	return std::bit_width(n | 1) - 1;
+}
 
-				changed = true;
-			}
-		}
-		data->state(sortvis::Sortable::SortState::Full, n);
-	} while(changed);
+/**
+ * @brief range of an intro sort with the partitions left before it falls back to heap sort
+ *
+ */
+struct IntroRange
+{
+	size_t first;
+	size_t last;
+	size_t depth;
+};
+
+/**
+ * @brief range of a pattern defeating quick sort, leftmost ranges have no pivot before them
+ *
+ */
+struct PdqRange
+{
+	size_t first;
+	size_t last;
+	size_t badAllowed;
+	bool leftmost;
+};
 
-	for(size_t i = 0; i <= n; ++i)
+/**
+ * @brief run of a TimSort on its run stack
+ *
+ */
+struct TimRun
+{
+	size_t first;
+	size_t last;
+};
+
+/**
+ * @return size_t shortest run TimSort creates, len / minimum run is a power of two or slightly less
+ */
+size_t timMinRun(size_t len) noexcept
+{
+	size_t low = 0;
+	while(len >= TIM_MIN_MERGE)
 	{
-		data->state(sortvis::Sortable::SortState::Full, i);
+		low |= len & 1;
+		len >>= 1;
 	}
+	return len + low;
+}
+
+/**
+ * @brief adapts minGallop after a round of galloping moved countA & countB elements
+ *
+ * @return true if galloping should go on
+ */
+bool keepGalloping(size_t countA, size_t countB, size_t& minGallop) noexcept
+{
+	const bool keep = countA >= TIM_MIN_GALLOP || countB >= TIM_MIN_GALLOP;
+	minGallop = keep ? std::max(minGallop, size_t(2)) - 1 : minGallop + 1;
+	return keep;
+}
+
+constexpr size_t RADIX_BITS = 8;
+constexpr size_t RADIX = size_t(1) << RADIX_BITS;
+constexpr size_t KEY_DIGITS = 32 / RADIX_BITS;
+constexpr size_t MSD_CUTOFF = 32;
+
+/**
+ * @return uint32_t key of value that compares unsigned like value compares signed
+ */
+constexpr uint32_t radixKey(int value) noexcept
+{
+	return static_cast<uint32_t>(value) ^ 0x80000000U;
 }
 
-cppcoro::generator<const int> quick(std::shared_ptr<sortvis::SortableCollection> data)
+/**
+ * @return size_t digit of key, digit 0 is the least significant
+ */
+constexpr size_t radixDigit(uint32_t key, size_t digit) noexcept
 {
-	std::stack<std::pair<size_t, size_t>> stack;
+	return (key >> (digit * RADIX_BITS)) & (RADIX - 1);
+}
 
-	stack.push(std::make_pair(0, data->size() - 1));
+/**
+ * @brief range of the elements whose keys share all digits above digit
+ *
+ */
+struct RadixBucket
+{
+	size_t first;
+	size_t last;
+	size_t digit;
+};
 
-	co_yield INIT_MAGIC_VALUE;
+/**
+ * @brief the algorithms as coroutines for policies::Instrumented & policies::Worker,
+ * they suspend after every step & resume nested algorithms in place
+ *
+ */
+namespace suspending
+{
+#define SORTVIS_STEP(VALUE) co_yield VALUE
+#define SORTVIS_NESTED(CALL) co_yield CALL
+#define SORTVIS_RETURN co_return
+#include "algorithms.inl"
+#undef SORTVIS_STEP
+#undef SORTVIS_NESTED
+#undef SORTVIS_RETURN
+} // namespace suspending
 
-	while(!stack.empty())
-	{
-		const size_t start = stack.top().first;
-		const size_t end = stack.top().second;
-		stack.pop();
+/**
+ * @brief the same algorithms as plain functions for policies::Native, nested algorithms are ordinary calls
+ *
+ */
+namespace direct
+{
+#define SORTVIS_STEP(VALUE) static_cast<void>(VALUE)
+#define SORTVIS_NESTED(CALL) CALL
+#define SORTVIS_RETURN return
+#include "algorithms.inl"
+#undef SORTVIS_STEP
+#undef SORTVIS_NESTED
+#undef SORTVIS_RETURN
+} // namespace direct
+
+std::atomic<size_t> laneSetting{0};
+std::atomic<size_t> batchSetting{sortvis::algorithms::DEFAULT_PARALLEL_BATCH};
 
-		size_t pivot = start;
+/**
+ * @brief ThreadPool shared by all LaneGroups of the process, one LaneGroup at a time runs on it
+ *
+ */
+struct LanePool
+{
+	std::mutex mutex;
+	std::unique_ptr<sortvis::ThreadPool> pool; //! parallelLanes() threads, created on first use
+};
 
-		for(size_t i = start; i < end; i++)
-		{
-			const bool greater = data->greater(i, end);
-			co_yield COMP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, i, end);
+LanePool& lanePool()
+{
+	static LanePool shared;
+	return shared;
+}
 
-			if(!greater)
-			{
-				data->swap(i, pivot);
-				co_yield SWAP_MAGIC_VALUE;
-				data->state(sortvis::Sortable::AccessState::None, i, pivot);
+/**
+ * @brief Lanes of a SortableCollection advanced in lockstep, every step resumes each busy Lane up to
+ * parallelBatch() times and joins all Lanes into the collection afterwards,
+ * the Lanes run on the shared LanePool unless it is in use or this already runs in a ThreadPool task,
+ * then they run one after another and the step is counted by SortableCollection::sequentialLanes
+ *
+ */
+class LaneGroup
+{
+private:
+	using Work = sortvis::Generator<const int>;
 
-				pivot++;
-			}
+	enum class Status : uint8_t
+	{
+		Idle,
+		Assigned,
+		Running
+	};
+
+	std::shared_ptr<sortvis::SortableCollection> data;
+	size_t batch;
+	std::vector<sortvis::Lane> lanes;
+	std::unique_ptr<sortvis::FrameArena[]> arenas; //! one per Lane, its frames are resumed on any thread
+	std::vector<Work> work;
+	std::vector<Work::iterator> positions;
+	std::vector<Status> status;
+	std::vector<size_t> busy;
+
+public:
+	/**
+	 * @brief Construct a new Lane Group object
+	 *
+	 * @param collection SortableCollection to sort
+	 * @param count number of Lanes
+	 */
+	LaneGroup(std::shared_ptr<sortvis::SortableCollection> collection, size_t count) :
+	    data{std::move(collection)}, batch{sortvis::algorithms::parallelBatch()},
+	    arenas{std::make_unique<sortvis::FrameArena[]>(count)}, work(count), positions(count),
+	    status(count, Status::Idle)
+	{
+		lanes.reserve(count);
+		for(size_t i = 0; i < count; ++i)
+		{
+			lanes.emplace_back(*data, i);
 		}
+	}
 
-		data->swap(pivot, end);
-		co_yield SWAP_MAGIC_VALUE;
-		data->state(sortvis::Sortable::AccessState::None, pivot, end);
-		data->state(sortvis::Sortable::SortState::Full, pivot);
+	[[nodiscard]] size_t size() const noexcept
+	{
+		return lanes.size();
+	}
 
-		if(pivot > 0 && pivot - 1 > start)
+	/**
+	 * @brief gives a Lane new work, started by the next step
+	 *
+	 * @tparam FACTORY invocable with sortvis::Lane* returning the Generator to run
+	 * @param laneIdx index of the Lane, must be idle
+	 * @param first first index of the Lane
+	 * @param count number of elements of the Lane
+	 * @param factory creates the work
+	 */
+	template<typename FACTORY>
+	void assign(size_t laneIdx, size_t first, size_t count, FACTORY factory)
+	{
+		lanes[laneIdx].retarget(first, count);
+		sortvis::FrameArena::Scope scope(arenas[laneIdx]);
+		work[laneIdx] = factory(&lanes[laneIdx]);
+		status[laneIdx] = Status::Assigned;
+	}
+
+	/**
+	 * @brief resumes every busy Lane up to batch times in parallel, Lanes that finished become idle
+	 *
+	 * @return false if all Lanes were idle
+	 */
+	bool step()
+	{
+		busy.clear();
+		for(size_t idx = 0; idx < status.size(); ++idx)
 		{
-			stack.push(std::make_pair(start, pivot - 1));
+			if(status[idx] != Status::Idle)
+			{
+				busy.push_back(idx);
+			}
 		}
-		else if(start != pivot)
+		if(busy.empty())
 		{
-			data->state(sortvis::Sortable::SortState::Full, start);
+			return false;
 		}
 
-		if(pivot + 1 < end)
+		auto resume = [this](size_t task)
+		{
+			const size_t idx = busy[task];
+			sortvis::FrameArena::Scope scope(arenas[idx]);
+			size_t op = 0;
+			if(status[idx] == Status::Assigned)
+			{
+				positions[idx] = work[idx].begin();
+				status[idx] = Status::Running;
+				++op;
+			}
+			for(; op < batch && positions[idx] != work[idx].end(); ++op)
+			{
+				++positions[idx];
+			}
+		};
+
+		LanePool& shared = lanePool();
+		std::unique_lock lock(shared.mutex, std::defer_lock);
+		if(busy.size() > 1 && !sortvis::ThreadPool::insideTask() && lock.try_lock())
+		{
+			const size_t threads = sortvis::algorithms::parallelLanes();
+			if(!shared.pool || shared.pool->size() != threads)
+			{
+				shared.pool.reset();
+				shared.pool = std::make_unique<sortvis::ThreadPool>(threads);
+			}
+			shared.pool->run(busy.size(), resume);
+		}
+		else
 		{
-			stack.push(std::make_pair(pivot + 1, end));
+			for(size_t task = 0; task < busy.size(); ++task)
+			{
+				resume(task);
+			}
+			if(busy.size() > 1)
+			{
+				data->sequentialLanes(busy.size());
+			}
 		}
-		else if(end != pivot)
+
+		for(size_t idx : busy)
 		{
-			data->state(sortvis::Sortable::SortState::Full, end);
+			if(positions[idx] == work[idx].end())
+			{
+				positions[idx] = {};
+				work[idx] = {};
+				status[idx] = Status::Idle;
+				lanes[idx].retarget(0, 0);
+			}
 		}
+		sortvis::Lane::join(*data, lanes);
+		return true;
 	}
+};
+
+constexpr size_t SAMPLE_OVERSAMPLING = 16;
+
+std::atomic<bool> vectorSetting{true};
+
+/**
+ * @brief runs a native algorithm on data, the aux arrays it allocates live until it returns
+ *
+ */
+template<typename... ARGS>
+void runNative(void (*algorithm)(sortvis::NativeData, ARGS...), std::span<int> data, ARGS... args)
+{
+	std::vector<std::vector<int>> aux;
+	algorithm(sortvis::NativeData(data, aux), args...);
 }
+} // namespace detail
 
-namespace detail
+sortvis::Generator<const int> bubble(std::shared_ptr<sortvis::SortableCollection> data)
 {
-size_t iParent(size_t i)
+	return detail::suspending::bubble<sortvis::policies::Instrumented>(std::move(data));
+}
+
+sortvis::Generator<const int> quick(std::shared_ptr<sortvis::SortableCollection> data)
 {
-	return (i - 1) / 2;
+	return detail::suspending::quick<sortvis::policies::Instrumented>(
+	    std::move(data), PivotStrategy::Last, Partition::Lomuto);
 }
-size_t iLeftChild(size_t i)
+
+sortvis::Generator<const int> hoareQuick(std::shared_ptr<sortvis::SortableCollection> data)
 {
-	return (2 * i) + 1;
+	return detail::suspending::quick<sortvis::policies::Instrumented>(
+	    std::move(data), PivotStrategy::MedianOfThree, Partition::Hoare);
 }
 
-cppcoro::generator<const int> siftDown(std::shared_ptr<sortvis::SortableCollection> data, size_t start, size_t end)
+sortvis::Generator<const int> threeWayQuick(std::shared_ptr<sortvis::SortableCollection> data)
 {
-	size_t root = start;
+	return detail::suspending::quick<sortvis::policies::Instrumented>(
+	    std::move(data), PivotStrategy::Ninther, Partition::ThreeWay);
+}
 
-	while(iLeftChild(root) <= end)
-	{
-		size_t child = iLeftChild(root);
-		size_t swap = root;
+sortvis::Generator<const int> randomQuick(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::quick<sortvis::policies::Instrumented>(
+	    std::move(data), PivotStrategy::Random, Partition::Hoare);
+}
 
-		bool isLess = data->less(swap, child);
-		co_yield COMP_MAGIC_VALUE;
-		data->state(sortvis::Sortable::AccessState::None, swap, child);
+sortvis::Generator<const int> heap(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::heap<sortvis::policies::Instrumented>(std::move(data));
+}
 
-		if(isLess)
-		{
-			swap = child;
-		}
-		if(child + 1 <= end)
-		{
-			isLess = data->less(swap, child + 1);
-			co_yield COMP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, swap, child + 1);
+sortvis::Generator<const int> shell(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::shell<sortvis::policies::Instrumented>(std::move(data), ShellGaps::Ciura);
+}
 
-			if(isLess)
-			{
-				swap = child + 1;
-			}
-		}
-		if(swap == root)
-		{
-			break;
-		}
+sortvis::Generator<const int> tokudaShell(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::shell<sortvis::policies::Instrumented>(std::move(data), ShellGaps::Tokuda);
+}
 
-		data->swap(root, swap);
-		co_yield SWAP_MAGIC_VALUE;
-		data->state(sortvis::Sortable::AccessState::None, root, swap);
+sortvis::Generator<const int> sedgewickShell(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::shell<sortvis::policies::Instrumented>(std::move(data), ShellGaps::Sedgewick);
+}
 
-		root = swap;
-	}
+sortvis::Generator<const int> insertion(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::insertion<sortvis::policies::Instrumented>(std::move(data));
 }
 
-cppcoro::generator<const int> heapify(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> selection(std::shared_ptr<sortvis::SortableCollection> data)
 {
-	size_t start = iParent(data->size() - 1);
+	return detail::suspending::selection<sortvis::policies::Instrumented>(std::move(data));
+}
 
-	while(start != -1)
-	{
-		cppcoro::generator<const int> generator = siftDown(data, start, data->size() - 1);
-		for(const int magicValue : generator)
-		{
-			co_yield magicValue;
-		}
-		--start;
-	}
+sortvis::Generator<const int> bitonic(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::bitonic<sortvis::policies::Instrumented>(std::move(data));
 }
-} // namespace detail
 
-cppcoro::generator<const int> heap(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> lsdRadix(std::shared_ptr<sortvis::SortableCollection> data)
 {
-	cppcoro::generator<const int> heapGenerator = detail::heapify(data);
-	size_t end = data->size() - 1;
+	return detail::suspending::lsdRadix<sortvis::policies::Instrumented>(std::move(data));
+}
 
-	co_yield INIT_MAGIC_VALUE;
+sortvis::Generator<const int> msdRadix(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::msdRadix<sortvis::policies::Instrumented>(std::move(data));
+}
 
-	for(const int magicValue : heapGenerator)
-	{
-		co_yield magicValue;
-	}
+sortvis::Generator<const int> topDownMerge(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::topDownMerge<sortvis::policies::Instrumented>(std::move(data));
+}
 
-	while(end > 0)
-	{
-		data->swap(0, end);
-		co_yield SWAP_MAGIC_VALUE;
-		data->state(sortvis::Sortable::AccessState::None, size_t(0), end);
+sortvis::Generator<const int> bottomUpMerge(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::bottomUpMerge<sortvis::policies::Instrumented>(std::move(data));
+}
 
-		data->state(sortvis::Sortable::SortState::Full, end);
-		end = end - 1;
+sortvis::Generator<const int> naturalMerge(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::naturalMerge<sortvis::policies::Instrumented>(std::move(data));
+}
 
-		cppcoro::generator<const int> shiftGenerator = detail::siftDown(data, 0, end);
-		for(const int magicValue : shiftGenerator)
-		{
-			co_yield magicValue;
-		}
-	}
+sortvis::Generator<const int> intro(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::intro<sortvis::policies::Instrumented>(std::move(data));
+}
 
-	data->state(sortvis::Sortable::SortState::Full, size_t(0));
+sortvis::Generator<const int> pdq(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	return detail::suspending::pdq<sortvis::policies::Instrumented>(std::move(data));
 }
 
-cppcoro::generator<const int> shell(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> tim(std::shared_ptr<sortvis::SortableCollection> data)
 {
-	const std::array<size_t, 8> gaps{701, 301, 132, 57, 23, 10, 4, 1};
+	return detail::suspending::tim<sortvis::policies::Instrumented>(std::move(data));
+}
 
+sortvis::Generator<const int> parallelMerge(std::shared_ptr<sortvis::SortableCollection> data)
+{
 	const size_t len = data->size();
+	detail::LaneGroup lanes(data, std::clamp(len / detail::MERGE_BLOCK, size_t(1), parallelLanes()));
 
 	co_yield INIT_MAGIC_VALUE;
 
-	for(size_t gap : gaps)
+	std::vector<size_t> runs;
+	for(size_t i = 0; i <= lanes.size(); ++i)
+	{
+		runs.push_back(i * len / lanes.size());
+	}
+	for(size_t i = 0; i < lanes.size(); ++i)
+	{
+		lanes.assign(i, runs[i], runs[i + 1] - runs[i],
+		    [](sortvis::Lane* lane)
+		    {
+			    return detail::suspending::mergeRange<sortvis::policies::Worker>(lane, 0, lane->size());
+		    });
+	}
+	while(lanes.step())
+	{
+		co_yield COMP_MAGIC_VALUE;
+	}
+
+	while(runs.size() > 2)
 	{
-		for(size_t i = gap; i < len; ++i)
+		const size_t runCount = runs.size() - 1;
+		std::vector<size_t> merged;
+		for(size_t i = 0; i < runCount; i += 2)
 		{
-			for(size_t j = i; j >= gap; j -= gap)
+			merged.push_back(runs[i]);
+			if(i + 1 < runCount)
 			{
-				bool greater = data->greater(j - gap, j);
-				co_yield COMP_MAGIC_VALUE;
-				data->state(sortvis::Sortable::AccessState::None, j - gap, j);
-
-				if(!greater)
-				{
-					break;
-				}
-
-				data->swap(j - gap, j);
-				co_yield SWAP_MAGIC_VALUE;
-				data->state(sortvis::Sortable::AccessState::None, j - gap, j);
+				lanes.assign(i / 2, runs[i], runs[i + 2] - runs[i],
+				    [middle = runs[i + 1] - runs[i]](sortvis::Lane* lane)
+				    {
+					    return detail::suspending::symMerge<sortvis::policies::Worker>(lane, 0, middle, lane->size());
+				    });
 			}
 		}
+		merged.push_back(len);
+		runs = std::move(merged);
+
+		while(lanes.step())
+		{
+			co_yield COMP_MAGIC_VALUE;
+		}
 	}
 
 	for(size_t i = 0; i < len; ++i)
@@ -231,105 +516,325 @@ cppcoro::generator<const int> shell(std::shared_ptr<sortvis::SortableCollection>
 	}
 }
 
-cppcoro::generator<const int> insertion(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> parallelSample(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	const size_t len = data->size();
+	const size_t buckets = std::clamp(len / (2 * detail::SAMPLE_OVERSAMPLING), size_t(1), parallelLanes());
+	detail::LaneGroup lanes(data, buckets);
 
 	co_yield INIT_MAGIC_VALUE;
 
-	for(size_t i = 1; i < len; ++i)
+	auto sortBucket = [](sortvis::Lane* lane)
+	{
+		return detail::suspending::quick<sortvis::policies::Worker>(lane, PivotStrategy::Ninther, Partition::ThreeWay);
+	};
+
+	if(buckets == 1)
 	{
-		for(size_t j = i; j > 0; --j)
+		if(len > 0)
+		{
+			lanes.assign(0, 0, len, sortBucket);
+		}
+		while(lanes.step())
 		{
-			bool greater = data->greater(j - 1, j);
 			co_yield COMP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
-
-			if(!greater)
-			{
-				break;
-			}
-
-			data->swap(j - 1, j);
-			co_yield SWAP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
 		}
+		co_return;
 	}
 
-	for(size_t i = 0; i < len; ++i)
+	lanes.assign(0, 0, len,
+	    [samples = buckets * detail::SAMPLE_OVERSAMPLING, buckets](sortvis::Lane* lane)
+	    {
+		    return detail::suspending::gatherSplitters<sortvis::policies::Worker>(lane, samples, buckets);
+	    });
+	while(lanes.step())
 	{
-		data->state(sortvis::Sortable::SortState::Full, i);
+		co_yield COMP_MAGIC_VALUE;
 	}
-}
 
-cppcoro::generator<const int> selection(std::shared_ptr<sortvis::SortableCollection> data)
-{
-	const size_t len = data->size();
-
-	co_yield INIT_MAGIC_VALUE;
-
-	for(size_t i = 0; i < len - 1; ++i)
+	/**
+	 * @brief elements [first, last) belong to the buckets [lo, hi)
+	 *
+	 */
+	struct Segment
 	{
-		size_t jMin = i;
-
-		for(size_t j = i + 1; j < len; ++j)
+		size_t first;
+		size_t last;
+		size_t lo;
+		size_t hi;
+	};
+
+	const size_t splitterFirst = len - (buckets - 1);
+	std::vector<Segment> segments{{0, splitterFirst, 0, buckets}};
+	std::vector<size_t> splits(buckets);
+	while(segments.size() < buckets)
+	{
+		size_t lane = 0;
+		for(const Segment& segment : segments)
+		{
+			if(segment.hi - segment.lo > 1)
+			{
+				const size_t splitter = splitterFirst + (segment.lo + segment.hi) / 2 - 1;
+				lanes.assign(lane, segment.first, segment.last - segment.first,
+				    [splitter, &split = splits[lane]](sortvis::Lane* lanePtr)
+				    {
+					    return detail::suspending::partitionShared<sortvis::policies::Worker>(lanePtr, splitter, split);
+				    });
+				++lane;
+			}
+		}
+		while(lanes.step())
 		{
-			bool less = data->less(j, jMin);
 			co_yield COMP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, j, jMin);
+		}
 
-			if(less)
+		std::vector<Segment> next;
+		lane = 0;
+		for(const Segment& segment : segments)
+		{
+			if(segment.hi - segment.lo > 1)
+			{
+				const size_t mid = (segment.lo + segment.hi) / 2;
+				const size_t split = segment.first + splits[lane++];
+				next.push_back({segment.first, split, segment.lo, mid});
+				next.push_back({split, segment.last, mid, segment.hi});
+			}
+			else
 			{
-				jMin = j;
+				next.push_back(segment);
 			}
 		}
+		segments = std::move(next);
+	}
+
+	std::vector<size_t> bounds;
+	for(const Segment& segment : segments)
+	{
+		bounds.push_back(segment.first);
+	}
+	bounds.push_back(splitterFirst);
+
+	lanes.assign(0, 0, len,
+	    [bounds](sortvis::Lane* lane)
+	    {
+		    return detail::suspending::placeSplitters<sortvis::policies::Worker>(lane, bounds);
+	    });
+	while(lanes.step())
+	{
+		co_yield COMP_MAGIC_VALUE;
+	}
 
-		if(jMin != i)
+	for(size_t k = 0; k < buckets; ++k)
+	{
+		const size_t first = bounds[k] + k;
+		const size_t last = bounds[k + 1] + k;
+		if(first < last)
 		{
-			data->swap(i, jMin);
-			co_yield SWAP_MAGIC_VALUE;
-			data->state(sortvis::Sortable::AccessState::None, i, jMin);
+			lanes.assign(k, first, last - first, sortBucket);
 		}
-
-		data->state(sortvis::Sortable::SortState::Full, i);
 	}
+	while(lanes.step())
+	{
+		co_yield COMP_MAGIC_VALUE;
+	}
+}
 
-	data->state(sortvis::Sortable::SortState::Full, len - 1);
+void setParallelLanes(size_t lanes) noexcept
+{
+	detail::laneSetting = lanes;
 }
-} // namespace sortvis::algorithms
 
-namespace sortvis
+size_t parallelLanes() noexcept
 {
-/**
- * @param algorithm function pointer to algo
- * @return const char* to name of algo
- */
-const char* getAlgorithmName(SorterAlgorithm algorithm)
+	const size_t lanes = detail::laneSetting;
+	return std::max(lanes != 0 ? lanes : size_t(std::thread::hardware_concurrency()), size_t(1));
+}
+
+void setParallelBatch(size_t operations) noexcept
 {
-	if(algorithm == sortvis::algorithms::bubble)
-	{
-		return "Bubble Sort";
-	}
-	if(algorithm == sortvis::algorithms::heap)
+	detail::batchSetting = std::max(operations, size_t(1));
+}
+
+size_t parallelBatch() noexcept
+{
+	return detail::batchSetting;
+}
+
+void setVectorKernels(bool enabled) noexcept
+{
+	detail::vectorSetting = enabled;
+}
+
+bool vectorKernels() noexcept
+{
+	return detail::vectorSetting && simd::supported();
+}
+
+std::vector<size_t> shellGaps(ShellGaps sequence, size_t elements)
+{
+	std::vector<size_t> gaps{1};
+	switch(sequence)
 	{
-		return "Heap Sort";
+	case ShellGaps::Ciura:
+		// measured by Ciura up to 701, extended by factors of 2.25
+		gaps = {1, 4, 10, 23, 57, 132, 301, 701};
+		while(gaps.back() < elements)
+		{
+			gaps.push_back(gaps.back() * 9 / 4);
+		}
+		break;
+	case ShellGaps::Tokuda:
+		// ceil(h'), h' = 2.25 h' + 1 starting at 1
+		for(double gap = 3.25; gaps.back() < elements; gap = gap * 2.25 + 1)
+		{
+			gaps.push_back(static_cast<size_t>(std::ceil(gap)));
+		}
+		break;
+	case ShellGaps::Sedgewick:
+		// 4^k + 3 * 2^(k - 1) + 1
+		for(size_t k = 1; gaps.back() < elements; ++k)
+		{
+			gaps.push_back((size_t(1) << (2 * k)) + 3 * (size_t(1) << (k - 1)) + 1);
+		}
+		break;
 	}
-	if(algorithm == sortvis::algorithms::insertion)
+
+	while(gaps.size() > 1 && gaps.back() >= elements)
 	{
-		return "Insertion Sort";
+		gaps.pop_back();
 	}
-	if(algorithm == sortvis::algorithms::selection)
+	std::reverse(gaps.begin(), gaps.end());
+	return gaps;
+}
+
+namespace native
+{
+void bubble(std::span<int> data)
+{
+	detail::runNative(detail::direct::bubble<sortvis::policies::Native>, data);
+}
+
+void quick(std::span<int> data)
+{
+	detail::runNative(detail::direct::quick<sortvis::policies::Native>, data, PivotStrategy::Last, Partition::Lomuto);
+}
+
+void hoareQuick(std::span<int> data)
+{
+	detail::runNative(
+	    detail::direct::quick<sortvis::policies::Native>, data, PivotStrategy::MedianOfThree, Partition::Hoare);
+}
+
+void threeWayQuick(std::span<int> data)
+{
+	detail::runNative(
+	    detail::direct::quick<sortvis::policies::Native>, data, PivotStrategy::Ninther, Partition::ThreeWay);
+}
+
+void randomQuick(std::span<int> data)
+{
+	detail::runNative(detail::direct::quick<sortvis::policies::Native>, data, PivotStrategy::Random, Partition::Hoare);
+}
+
+void heap(std::span<int> data)
+{
+	detail::runNative(detail::direct::heap<sortvis::policies::Native>, data);
+}
+
+void shell(std::span<int> data)
+{
+	detail::runNative(detail::direct::shell<sortvis::policies::Native>, data, ShellGaps::Ciura);
+}
+
+void tokudaShell(std::span<int> data)
+{
+	detail::runNative(detail::direct::shell<sortvis::policies::Native>, data, ShellGaps::Tokuda);
+}
+
+void sedgewickShell(std::span<int> data)
+{
+	detail::runNative(detail::direct::shell<sortvis::policies::Native>, data, ShellGaps::Sedgewick);
+}
+
+void insertion(std::span<int> data)
+{
+	detail::runNative(detail::direct::insertion<sortvis::policies::Native>, data);
+}
+
+void selection(std::span<int> data)
+{
+	detail::runNative(detail::direct::selection<sortvis::policies::Native>, data);
+}
+
+void bitonic(std::span<int> data)
+{
+	if(!vectorKernels())
 	{
-		return "Selection Sort";
+		detail::runNative(detail::direct::bitonic<sortvis::policies::Native>, data);
+		return;
 	}
-	if(algorithm == sortvis::algorithms::quick)
+
+	simd::sortBlocks(data);
+
+	// the same merge passes as the scalar source with the AVX2 merge kernel
+	std::vector<int> buffer(data.size());
+	std::span<int> from = data;
+	std::span<int> to = buffer;
+	for(size_t width = simd::BLOCK; width < data.size(); width *= 2)
 	{
-		return "Quick Sort";
+		for(size_t lo = 0; lo < data.size(); lo += 2 * width)
+		{
+			const size_t middle = std::min(lo + width, data.size());
+			const std::span<const int> lhs = from.subspan(lo, middle - lo);
+			const std::span<const int> rhs = from.subspan(middle, std::min(middle + width, data.size()) - middle);
+			simd::merge(lhs, rhs, to.data() + lo);
+		}
+		std::swap(from, to);
 	}
-	if(algorithm == sortvis::algorithms::shell)
+	if(from.data() != data.data())
 	{
-		return "Shell Sort";
+		std::copy(from.begin(), from.end(), data.begin());
 	}
-	return "UNKNOWN";
 }
-} // namespace sortvis
+
+void lsdRadix(std::span<int> data)
+{
+	detail::runNative(detail::direct::lsdRadix<sortvis::policies::Native>, data);
+}
+
+void msdRadix(std::span<int> data)
+{
+	detail::runNative(detail::direct::msdRadix<sortvis::policies::Native>, data);
+}
+
+void topDownMerge(std::span<int> data)
+{
+	detail::runNative(detail::direct::topDownMerge<sortvis::policies::Native>, data);
+}
+
+void bottomUpMerge(std::span<int> data)
+{
+	detail::runNative(detail::direct::bottomUpMerge<sortvis::policies::Native>, data);
+}
+
+void naturalMerge(std::span<int> data)
+{
+	detail::runNative(detail::direct::naturalMerge<sortvis::policies::Native>, data);
+}
+
+void intro(std::span<int> data)
+{
+	detail::runNative(detail::direct::intro<sortvis::policies::Native>, data);
+}
+
+void pdq(std::span<int> data)
+{
+	detail::runNative(detail::direct::pdq<sortvis::policies::Native>, data);
+}
+
+void tim(std::span<int> data)
+{
+	detail::runNative(detail::direct::tim<sortvis::policies::Native>, data);
+}
+} // namespace native
+} // namespace sortvis::algorithms
@@ -0,0 +1,2093 @@
+// the policy templates of the sorting algorithms, algorithms.cpp includes this inside a namespace once per
+// execution model with SORTVIS_STEP(VALUE) ending a step, SORTVIS_NESTED(CALL) running a nested algorithm and
+// SORTVIS_RETURN leaving early defined, so the same source becomes suspending coroutines and plain functions
+
+template<typename POLICY>
+typename POLICY::Generator bubble(typename POLICY::Data data)
+{
+	bool changed = false;
+	size_t n = data->size();
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	if(n == 0)
+	{
+		SORTVIS_RETURN;
+	}
+
+	do
+	{
+		--n;
+		changed = false;
+		for(size_t i = 0; i < n; ++i)
+		{
+			bool isLess = data->less(i + 1, i);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, i + 1);
+
+			if(isLess)
+			{
+				data->swap(i + 1, i);
+				SORTVIS_STEP(SWAP_MAGIC_VALUE);
+				data->state(sortvis::Sortable::AccessState::None, i, i + 1);
+
+				changed = true;
+			}
+		}
+		data->state(sortvis::Sortable::SortState::Full, n);
+	} while(changed);
+
+	for(size_t i = 0; i <= n; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+/**
+ * @brief sifts the element at start down the max heap [base, base + end], start & end are relative to base
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator siftDown(typename POLICY::Data data, size_t start, size_t end, size_t base = 0)
+{
+	size_t root = start;
+
+	while(iLeftChild(root) <= end)
+	{
+		size_t child = iLeftChild(root);
+		size_t swap = root;
+
+		bool isLess = data->less(base + swap, base + child);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, base + swap, base + child);
+
+		if(isLess)
+		{
+			swap = child;
+		}
+		if(child + 1 <= end)
+		{
+			isLess = data->less(base + swap, base + child + 1);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, base + swap, base + child + 1);
+
+			if(isLess)
+			{
+				swap = child + 1;
+			}
+		}
+		if(swap == root)
+		{
+			break;
+		}
+
+		data->swap(base + root, base + swap);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, base + root, base + swap);
+
+		root = swap;
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator heapify(typename POLICY::Data data)
+{
+	if(data->size() < 2)
+	{
+		SORTVIS_RETURN;
+	}
+
+	size_t start = iParent(data->size() - 1);
+
+	while(start != -1)
+	{
+		SORTVIS_NESTED(siftDown<POLICY>(data, start, data->size() - 1));
+		--start;
+	}
+}
+template<typename POLICY>
+typename POLICY::Generator heap(typename POLICY::Data data)
+{
+	size_t end = data->size() - 1;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	if(data->size() == 0)
+	{
+		SORTVIS_RETURN;
+	}
+
+	SORTVIS_NESTED(heapify<POLICY>(data));
+
+	while(end > 0)
+	{
+		data->swap(0, end);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, size_t(0), end);
+
+		data->state(sortvis::Sortable::SortState::Full, end);
+		end = end - 1;
+
+		SORTVIS_NESTED(siftDown<POLICY>(data, 0, end));
+	}
+
+	data->state(sortvis::Sortable::SortState::Full, size_t(0));
+}
+
+template<typename POLICY>
+typename POLICY::Generator shell(typename POLICY::Data data, sortvis::algorithms::ShellGaps sequence)
+{
+	const size_t len = data->size();
+	const std::vector<size_t> gaps = sortvis::algorithms::shellGaps(sequence, len);
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	for(size_t gap : gaps)
+	{
+		for(size_t i = gap; i < len; ++i)
+		{
+			for(size_t j = i; j >= gap; j -= gap)
+			{
+				bool greater = data->greater(j - gap, j);
+				SORTVIS_STEP(COMP_MAGIC_VALUE);
+				data->state(sortvis::Sortable::AccessState::None, j - gap, j);
+
+				if(!greater)
+				{
+					break;
+				}
+
+				data->swap(j - gap, j);
+				SORTVIS_STEP(SWAP_MAGIC_VALUE);
+				data->state(sortvis::Sortable::AccessState::None, j - gap, j);
+			}
+		}
+	}
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator insertion(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	for(size_t i = 1; i < len; ++i)
+	{
+		for(size_t j = i; j > 0; --j)
+		{
+			bool greater = data->greater(j - 1, j);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
+
+			if(!greater)
+			{
+				break;
+			}
+
+			data->swap(j - 1, j);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
+		}
+	}
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator selection(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	if(len == 0)
+	{
+		SORTVIS_RETURN;
+	}
+
+	for(size_t i = 0; i < len - 1; ++i)
+	{
+		size_t jMin = i;
+
+		for(size_t j = i + 1; j < len; ++j)
+		{
+			bool less = data->less(j, jMin);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j, jMin);
+
+			if(less)
+			{
+				jMin = j;
+			}
+		}
+
+		if(jMin != i)
+		{
+			data->swap(i, jMin);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, jMin);
+		}
+
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+
+	data->state(sortvis::Sortable::SortState::Full, len - 1);
+}
+
+/**
+ * @brief insertion sort of [first, last) without marking anything as sorted
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator insertionRange(typename POLICY::Data data, size_t first, size_t last)
+{
+	for(size_t i = first + 1; i < last; ++i)
+	{
+		for(size_t j = i; j > first; --j)
+		{
+			const bool greater = data->greater(j - 1, j);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
+
+			if(!greater)
+			{
+				break;
+			}
+
+			data->swap(j - 1, j);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
+		}
+	}
+}
+
+/**
+ * @brief swaps the blocks [lhs, lhs + count) and [rhs, rhs + count) element by element
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator swapBlocks(typename POLICY::Data data, size_t lhs, size_t rhs, size_t count)
+{
+	for(size_t i = 0; i < count; ++i)
+	{
+		data->swap(lhs + i, rhs + i);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, lhs + i, rhs + i);
+	}
+}
+
+/**
+ * @brief rotates [first, last) so that middle becomes first, keeps the order of both parts
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator rotate(typename POLICY::Data data, size_t first, size_t middle, size_t last)
+{
+	size_t left = middle - first;
+	size_t right = last - middle;
+	if(left == 0 || right == 0)
+	{
+		SORTVIS_RETURN;
+	}
+	while(left != right)
+	{
+		if(left > right)
+		{
+			SORTVIS_NESTED(swapBlocks<POLICY>(data, middle - left, middle, right));
+			left -= right;
+		}
+		else
+		{
+			SORTVIS_NESTED(swapBlocks<POLICY>(data, middle - left, middle + right - left, left));
+			right -= left;
+		}
+	}
+	SORTVIS_NESTED(swapBlocks<POLICY>(data, middle - left, middle, left));
+}
+
+/**
+ * @brief stable in place merge of the sorted ranges [first, middle) and [middle, last)
+ * with compares & swaps only (SymMerge by Kim & Kutzner)
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator symMerge(typename POLICY::Data data, size_t first, size_t middle, size_t last)
+{
+	if(first >= middle || middle >= last)
+	{
+		SORTVIS_RETURN;
+	}
+	if(middle - first == 1)
+	{
+		size_t lo = middle;
+		size_t hi = last;
+		while(lo < hi)
+		{
+			const size_t half = lo + (hi - lo) / 2;
+			const bool isLess = data->less(half, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, half, first);
+
+			if(isLess)
+			{
+				lo = half + 1;
+			}
+			else
+			{
+				hi = half;
+			}
+		}
+		for(size_t k = first; k + 1 < lo; ++k)
+		{
+			data->swap(k, k + 1);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, k, k + 1);
+		}
+		SORTVIS_RETURN;
+	}
+	if(last - middle == 1)
+	{
+		size_t lo = first;
+		size_t hi = middle;
+		while(lo < hi)
+		{
+			const size_t half = lo + (hi - lo) / 2;
+			const bool isLess = data->less(middle, half);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, middle, half);
+
+			if(!isLess)
+			{
+				lo = half + 1;
+			}
+			else
+			{
+				hi = half;
+			}
+		}
+		for(size_t k = middle; k > lo; --k)
+		{
+			data->swap(k, k - 1);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, k, k - 1);
+		}
+		SORTVIS_RETURN;
+	}
+
+	const size_t mid = first + (last - first) / 2;
+	const size_t sum = mid + middle;
+	size_t start = middle > mid ? sum - last : first;
+	size_t end = middle > mid ? mid : middle;
+	while(start < end)
+	{
+		const size_t half = start + (end - start) / 2;
+		const bool isLess = data->less(sum - 1 - half, half);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, sum - 1 - half, half);
+
+		if(!isLess)
+		{
+			start = half + 1;
+		}
+		else
+		{
+			end = half;
+		}
+	}
+	end = sum - start;
+
+	if(start < middle && middle < end)
+	{
+		SORTVIS_NESTED(rotate<POLICY>(data, start, middle, end));
+	}
+	if(first < start && start < mid)
+	{
+		SORTVIS_NESTED(symMerge<POLICY>(data, first, start, mid));
+	}
+	if(mid < end && end < last)
+	{
+		SORTVIS_NESTED(symMerge<POLICY>(data, mid, end, last));
+	}
+}
+
+/**
+ * @brief bottom up in place merge sort of [first, last), blocks of MERGE_BLOCK are insertion sorted first,
+ * nothing is marked as sorted
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator mergeRange(typename POLICY::Data data, size_t first, size_t last)
+{
+	for(size_t block = first; block < last; block += MERGE_BLOCK)
+	{
+		SORTVIS_NESTED(insertionRange<POLICY>(data, block, std::min(block + MERGE_BLOCK, last)));
+	}
+	for(size_t width = MERGE_BLOCK; width < last - first; width *= 2)
+	{
+		for(size_t lo = first; lo + width < last; lo += 2 * width)
+		{
+			SORTVIS_NESTED(symMerge<POLICY>(data, lo, lo + width, std::min(lo + 2 * width, last)));
+		}
+	}
+}
+
+/**
+ * @brief copies count elements of buffer source at sourceFirst to buffer target at targetFirst,
+ * last to first if backwards to allow overlapping ranges within one buffer
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator copyRun(typename POLICY::Data data, size_t source, size_t sourceFirst, size_t target,
+    size_t targetFirst, size_t count, bool backwards = false)
+{
+	for(size_t n = 0; n < count; ++n)
+	{
+		const size_t offset = backwards ? count - 1 - n : n;
+		const int value = data->read(source, sourceFirst + offset);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->bufferState(source, sortvis::Sortable::AccessState::None, sourceFirst + offset);
+
+		data->write(target, targetFirst + offset, value);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->bufferState(target, sortvis::Sortable::AccessState::None, targetFirst + offset);
+	}
+}
+
+/**
+ * @brief stable merge of the sorted runs [first, middle) and [middle, last) of buffer source
+ * into [first, last) of buffer target, every element is read & written once
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator mergeThrough(
+    typename POLICY::Data data, size_t source, size_t target, size_t first, size_t middle, size_t last)
+{
+	size_t l = first;
+	size_t r = middle;
+	int left = data->read(source, l);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->bufferState(source, sortvis::Sortable::AccessState::None, l);
+	int right = data->read(source, r);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->bufferState(source, sortvis::Sortable::AccessState::None, r);
+
+	for(size_t k = first; k < last; ++k)
+	{
+		const bool takeRight = l == middle || (r < last && right < left);
+		data->write(target, k, takeRight ? right : left);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->bufferState(target, sortvis::Sortable::AccessState::None, k);
+
+		size_t& next = takeRight ? r : l;
+		if(++next < (takeRight ? last : middle))
+		{
+			(takeRight ? right : left) = data->read(source, next);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->bufferState(source, sortvis::Sortable::AccessState::None, next);
+		}
+	}
+}
+
+/**
+ * @brief stable merge of the sorted runs [first, middle) and [middle, last) of the elements,
+ * only the lower run is copied into aux, which needs at least middle - first elements
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator mergeLower(typename POLICY::Data data, size_t aux, size_t first, size_t middle, size_t last)
+{
+	const size_t lower = middle - first;
+	SORTVIS_NESTED(copyRun<POLICY>(data, sortvis::SortableCollection::MAIN_BUFFER, first, aux, 0, lower));
+
+	size_t l = 0;
+	size_t r = middle;
+	int left = data->read(aux, l);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->bufferState(aux, sortvis::Sortable::AccessState::None, l);
+	int right = data->read(r);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, r);
+
+	// once the lower run is used up the rest of the upper run already is in place
+	for(size_t k = first; l < lower; ++k)
+	{
+		const bool takeRight = r < last && right < left;
+		data->write(k, takeRight ? right : left);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, k);
+
+		if(takeRight && ++r < last)
+		{
+			right = data->read(r);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, r);
+		}
+		else if(!takeRight && ++l < lower)
+		{
+			left = data->read(aux, l);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->bufferState(aux, sortvis::Sortable::AccessState::None, l);
+		}
+	}
+}
+
+/**
+ * @brief finds the run starting at start, a non descending run is kept, a strictly descending one is reversed
+ * so equal elements stay in order
+ *
+ * @param end receives the end of the run
+ */
+template<typename POLICY>
+typename POLICY::Generator findRun(typename POLICY::Data data, size_t start, size_t& end)
+{
+	end = start + 1;
+	if(end >= data->size())
+	{
+		SORTVIS_RETURN;
+	}
+
+	const bool descending = data->less(end, end - 1);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, end, end - 1);
+
+	for(++end; end < data->size(); ++end)
+	{
+		const bool isLess = data->less(end, end - 1);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, end, end - 1);
+
+		if(isLess != descending)
+		{
+			break;
+		}
+	}
+
+	for(size_t lo = start, hi = end - 1; descending && lo < hi; ++lo, --hi)
+	{
+		data->swap(lo, hi);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, lo, hi);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator topDownMerge(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::stack<MergeFrame> stack;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	// the lower half of a range is never longer than len / 2
+	const size_t aux = data->allocate(len / 2);
+	stack.push({0, len, false});
+	while(!stack.empty())
+	{
+		const MergeFrame frame = stack.top();
+		stack.pop();
+
+		const size_t middle = frame.first + (frame.last - frame.first) / 2;
+		if(frame.split)
+		{
+			SORTVIS_NESTED(mergeLower<POLICY>(data, aux, frame.first, middle, frame.last));
+		}
+		else if(frame.last - frame.first > 1)
+		{
+			stack.push({frame.first, frame.last, true});
+			stack.push({middle, frame.last, false});
+			stack.push({frame.first, middle, false});
+		}
+	}
+	data->release(aux);
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator bottomUpMerge(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	const size_t aux = data->allocate(len);
+	size_t source = sortvis::SortableCollection::MAIN_BUFFER;
+	size_t target = aux;
+	for(size_t width = 1; width < len; width *= 2)
+	{
+		for(size_t lo = 0; lo < len; lo += 2 * width)
+		{
+			if(lo + width < len)
+			{
+				SORTVIS_NESTED(
+				    mergeThrough<POLICY>(data, source, target, lo, lo + width, std::min(lo + 2 * width, len)));
+			}
+			else
+			{
+				SORTVIS_NESTED(copyRun<POLICY>(data, source, lo, target, lo, len - lo));
+			}
+		}
+		std::swap(source, target);
+	}
+
+	if(source == aux)
+	{
+		SORTVIS_NESTED(copyRun<POLICY>(data, aux, 0, sortvis::SortableCollection::MAIN_BUFFER, 0, len));
+	}
+	data->release(aux);
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator naturalMerge(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::vector<size_t> bounds{0};
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	for(size_t start = 0; start < len; start = bounds.back())
+	{
+		size_t end = 0;
+		SORTVIS_NESTED(findRun<POLICY>(data, start, end));
+		bounds.push_back(end);
+	}
+
+	// a single run is sorted already and needs no aux array
+	if(bounds.size() > 2)
+	{
+		const size_t aux = data->allocate(len);
+		size_t source = sortvis::SortableCollection::MAIN_BUFFER;
+		size_t target = aux;
+		while(bounds.size() > 2)
+		{
+			std::vector<size_t> merged{0};
+			for(size_t run = 0; run + 1 < bounds.size(); run += 2)
+			{
+				if(run + 2 < bounds.size())
+				{
+					SORTVIS_NESTED(mergeThrough<POLICY>(
+					    data, source, target, bounds[run], bounds[run + 1], bounds[run + 2]));
+					merged.push_back(bounds[run + 2]);
+				}
+				else
+				{
+					SORTVIS_NESTED(copyRun<POLICY>(
+					    data, source, bounds[run], target, bounds[run], bounds[run + 1] - bounds[run]));
+					merged.push_back(bounds[run + 1]);
+				}
+			}
+			bounds = std::move(merged);
+			std::swap(source, target);
+		}
+
+		if(source == aux)
+		{
+			SORTVIS_NESTED(copyRun<POLICY>(data, aux, 0, sortvis::SortableCollection::MAIN_BUFFER, 0, len));
+		}
+		data->release(aux);
+	}
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+/**
+ * @brief marks [first, last) as sorted
+ *
+ */
+template<typename POLICY>
+void markFull(typename POLICY::Data& data, size_t first, size_t last)
+{
+	for(size_t i = first; i < last; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+/**
+ * @brief heap sort of [first, last) without marking anything as sorted
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator heapRange(typename POLICY::Data data, size_t first, size_t last)
+{
+	const size_t count = last - first;
+	if(count < 2)
+	{
+		SORTVIS_RETURN;
+	}
+	for(size_t start = iParent(count - 1) + 1; start-- > 0;)
+	{
+		SORTVIS_NESTED(siftDown<POLICY>(data, start, count - 1, first));
+	}
+	for(size_t end = count - 1; end > 0; --end)
+	{
+		data->swap(first, first + end);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, first, first + end);
+
+		SORTVIS_NESTED(siftDown<POLICY>(data, 0, end - 1, first));
+	}
+}
+
+/**
+ * @brief orders the elements at a, b & c ascending with three compare & swaps
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator sort3(typename POLICY::Data data, size_t a, size_t b, size_t c)
+{
+	const std::array<std::pair<size_t, size_t>, 3> pairs{{{a, b}, {b, c}, {a, b}}};
+	for(const auto& [lhs, rhs] : pairs)
+	{
+		const bool greater = data->greater(lhs, rhs);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, lhs, rhs);
+
+		if(greater)
+		{
+			data->swap(lhs, rhs);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, lhs, rhs);
+		}
+	}
+}
+
+/**
+ * @brief moves the median of three elements of [first, last), or the median of three such medians
+ * for ranges longer than PDQ_NINTHER, to first
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator choosePivot(typename POLICY::Data data, size_t first, size_t last)
+{
+	const size_t mid = first + (last - first) / 2;
+	if(last - first <= PDQ_NINTHER)
+	{
+		SORTVIS_NESTED(sort3<POLICY>(data, mid, first, last - 1));
+		SORTVIS_RETURN;
+	}
+
+	SORTVIS_NESTED(sort3<POLICY>(data, first, mid, last - 1));
+	SORTVIS_NESTED(sort3<POLICY>(data, first + 1, mid - 1, last - 2));
+	SORTVIS_NESTED(sort3<POLICY>(data, first + 2, mid + 1, last - 3));
+	SORTVIS_NESTED(sort3<POLICY>(data, mid - 1, mid, mid + 1));
+	data->swap(first, mid);
+	SORTVIS_STEP(SWAP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, first, mid);
+}
+
+/**
+ * @brief partitions [first, last) around the pivot at first, smaller elements go left & equal ones right
+ *
+ * @param pivot receives the final index of the pivot
+ * @param alreadyPartitioned receives true if no elements had to be swapped
+ */
+template<typename POLICY>
+typename POLICY::Generator partitionRight(
+    typename POLICY::Data data, size_t first, size_t last, size_t& pivot, bool& alreadyPartitioned)
+{
+	size_t i = first + 1;
+	size_t j = last;
+	alreadyPartitioned = true;
+	while(true)
+	{
+		for(; i < j; ++i)
+		{
+			const bool isLess = data->less(i, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, first);
+
+			if(!isLess)
+			{
+				break;
+			}
+		}
+		for(; i < j; --j)
+		{
+			const bool isLess = data->less(j - 1, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, first);
+
+			if(isLess)
+			{
+				break;
+			}
+		}
+		if(i >= j)
+		{
+			break;
+		}
+
+		data->swap(i, j - 1);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i, j - 1);
+
+		alreadyPartitioned = false;
+		++i;
+		--j;
+	}
+
+	pivot = i - 1;
+	if(pivot != first)
+	{
+		data->swap(first, pivot);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, first, pivot);
+	}
+}
+
+/**
+ * @brief partitions [first, last) around the pivot at first, equal elements go left & larger ones right
+ *
+ * @param pivot receives the final index of the pivot
+ */
+template<typename POLICY>
+typename POLICY::Generator partitionLeft(typename POLICY::Data data, size_t first, size_t last, size_t& pivot)
+{
+	size_t i = first + 1;
+	size_t j = last;
+	while(true)
+	{
+		for(; i < j; ++i)
+		{
+			const bool greater = data->greater(i, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, first);
+
+			if(greater)
+			{
+				break;
+			}
+		}
+		for(; i < j; --j)
+		{
+			const bool greater = data->greater(j - 1, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, first);
+
+			if(!greater)
+			{
+				break;
+			}
+		}
+		if(i >= j)
+		{
+			break;
+		}
+
+		data->swap(i, j - 1);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i, j - 1);
+
+		++i;
+		--j;
+	}
+
+	pivot = i - 1;
+	if(pivot != first)
+	{
+		data->swap(first, pivot);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, first, pivot);
+	}
+}
+
+/**
+ * @brief insertion sort of [first, last) that gives up after PDQ_PARTIAL_LIMIT swaps
+ *
+ * @param sorted receives true if the range got sorted
+ */
+template<typename POLICY>
+typename POLICY::Generator partialInsertion(typename POLICY::Data data, size_t first, size_t last, bool& sorted)
+{
+	size_t swaps = 0;
+	sorted = false;
+	for(size_t i = first + 1; i < last; ++i)
+	{
+		for(size_t j = i; j > first; --j)
+		{
+			const bool greater = data->greater(j - 1, j);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
+
+			if(!greater)
+			{
+				break;
+			}
+			if(++swaps > PDQ_PARTIAL_LIMIT)
+			{
+				SORTVIS_RETURN;
+			}
+
+			data->swap(j - 1, j);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j - 1, j);
+		}
+	}
+	sorted = true;
+}
+
+/**
+ * @brief swaps both ends of [first, last) with the elements a quarter into it
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator breakPatterns(typename POLICY::Data data, size_t first, size_t last)
+{
+	const size_t quarter = (last - first) / 4;
+	const std::array<std::pair<size_t, size_t>, 2> pairs{{{first, first + quarter}, {last - 1, last - quarter}}};
+	for(const auto& [lhs, rhs] : pairs)
+	{
+		data->swap(lhs, rhs);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, lhs, rhs);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator intro(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::stack<IntroRange> stack;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	stack.push({0, len, 2 * floorLog2(len)});
+	while(!stack.empty())
+	{
+		const IntroRange range = stack.top();
+		stack.pop();
+
+		if(range.last - range.first <= INTRO_CUTOFF)
+		{
+			SORTVIS_NESTED(insertionRange<POLICY>(data, range.first, range.last));
+			markFull<POLICY>(data, range.first, range.last);
+			continue;
+		}
+		if(range.depth == 0)
+		{
+			SORTVIS_NESTED(heapRange<POLICY>(data, range.first, range.last));
+			markFull<POLICY>(data, range.first, range.last);
+			continue;
+		}
+
+		SORTVIS_NESTED(sort3<POLICY>(data, range.first + (range.last - range.first) / 2, range.first, range.last - 1));
+		size_t pivot = 0;
+		bool alreadyPartitioned = false;
+		SORTVIS_NESTED(partitionRight<POLICY>(data, range.first, range.last, pivot, alreadyPartitioned));
+		data->state(sortvis::Sortable::SortState::Full, pivot);
+
+		stack.push({pivot + 1, range.last, range.depth - 1});
+		stack.push({range.first, pivot, range.depth - 1});
+	}
+}
+
+/**
+ * @brief moves the pivot chosen by strategy from [first, last) to target
+ *
+ * @param draws counter of the random pivots drawn so far
+ */
+template<typename POLICY>
+typename POLICY::Generator placePivot(typename POLICY::Data data, size_t first, size_t last, size_t target,
+    sortvis::algorithms::PivotStrategy strategy, const sortvis::CounterRng& rng, uint64_t& draws)
+{
+	size_t pivot = first;
+	switch(strategy)
+	{
+	case sortvis::algorithms::PivotStrategy::Last:
+		pivot = last - 1;
+		break;
+	case sortvis::algorithms::PivotStrategy::MedianOfThree:
+		SORTVIS_NESTED(sort3<POLICY>(data, first + (last - first) / 2, first, last - 1));
+		break;
+	case sortvis::algorithms::PivotStrategy::Ninther:
+		SORTVIS_NESTED(choosePivot<POLICY>(data, first, last));
+		break;
+	case sortvis::algorithms::PivotStrategy::Random:
+		pivot = first + rng.below(last - first, draws++);
+		break;
+	}
+
+	if(pivot != target)
+	{
+		data->swap(pivot, target);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, pivot, target);
+	}
+}
+
+/**
+ * @brief Lomuto partition of [first, last) around the pivot at last - 1, one index scans the range
+ *
+ * @param pivot receives the final index of the pivot
+ */
+template<typename POLICY>
+typename POLICY::Generator partitionLomuto(typename POLICY::Data data, size_t first, size_t last, size_t& pivot)
+{
+	const size_t end = last - 1;
+	pivot = first;
+	for(size_t i = first; i < end; i++)
+	{
+		const bool greater = data->greater(i, end);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i, end);
+
+		if(!greater)
+		{
+			data->swap(i, pivot);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, pivot);
+
+			pivot++;
+		}
+	}
+
+	data->swap(pivot, end);
+	SORTVIS_STEP(SWAP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, pivot, end);
+}
+
+/**
+ * @brief Hoare partition of [first, last) around the pivot at first, both indices stop at equal elements
+ * so runs of equal elements are split evenly
+ *
+ * @param pivot receives the final index of the pivot
+ */
+template<typename POLICY>
+typename POLICY::Generator partitionHoare(typename POLICY::Data data, size_t first, size_t last, size_t& pivot)
+{
+	size_t i = first;
+	size_t j = last;
+	while(true)
+	{
+		while(++i < j)
+		{
+			const bool isLess = data->less(i, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, first);
+
+			if(!isLess)
+			{
+				break;
+			}
+		}
+		while(--j > first)
+		{
+			const bool greater = data->greater(j, first);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, j, first);
+
+			if(!greater)
+			{
+				break;
+			}
+		}
+		if(i >= j)
+		{
+			break;
+		}
+
+		data->swap(i, j);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i, j);
+	}
+
+	pivot = j;
+	if(pivot != first)
+	{
+		data->swap(first, pivot);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, first, pivot);
+	}
+}
+
+/**
+ * @brief Dutch national flag partition of [first, last) around the pivot at first into smaller, equal
+ * & larger elements
+ *
+ * @param lower receives the first element equal to the pivot
+ * @param upper receives the first element larger than the pivot
+ */
+template<typename POLICY>
+typename POLICY::Generator partitionThreeWay(
+    typename POLICY::Data data, size_t first, size_t last, size_t& lower, size_t& upper)
+{
+	// [first, lower) < pivot, [lower, i) == pivot, [upper, last) > pivot, the pivot stays at lower
+	lower = first;
+	upper = last;
+	size_t i = first + 1;
+	while(i < upper)
+	{
+		const bool isLess = data->less(i, lower);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i, lower);
+
+		if(isLess)
+		{
+			data->swap(i, lower);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, lower);
+			++lower;
+			++i;
+			continue;
+		}
+
+		const bool greater = data->greater(i, lower);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i, lower);
+
+		if(greater)
+		{
+			--upper;
+			data->swap(i, upper);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, upper);
+		}
+		else
+		{
+			++i;
+		}
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator quick(
+    typename POLICY::Data data, sortvis::algorithms::PivotStrategy strategy, sortvis::algorithms::Partition partition)
+{
+	const size_t len = data->size();
+	const sortvis::CounterRng rng(len);
+	uint64_t draws = 0;
+	std::stack<std::pair<size_t, size_t>> stack;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	stack.push(std::make_pair(0, len));
+	while(!stack.empty())
+	{
+		const auto [first, last] = stack.top();
+		stack.pop();
+
+		if(last - first < 2)
+		{
+			markFull<POLICY>(data, first, last);
+			continue;
+		}
+
+		size_t lower = 0;
+		size_t upper = 0;
+		switch(partition)
+		{
+		case sortvis::algorithms::Partition::Lomuto:
+			SORTVIS_NESTED(placePivot<POLICY>(data, first, last, last - 1, strategy, rng, draws));
+			SORTVIS_NESTED(partitionLomuto<POLICY>(data, first, last, lower));
+			upper = lower + 1;
+			break;
+		case sortvis::algorithms::Partition::Hoare:
+			SORTVIS_NESTED(placePivot<POLICY>(data, first, last, first, strategy, rng, draws));
+			SORTVIS_NESTED(partitionHoare<POLICY>(data, first, last, lower));
+			upper = lower + 1;
+			break;
+		case sortvis::algorithms::Partition::ThreeWay:
+			SORTVIS_NESTED(placePivot<POLICY>(data, first, last, first, strategy, rng, draws));
+			SORTVIS_NESTED(partitionThreeWay<POLICY>(data, first, last, lower, upper));
+			break;
+		}
+		markFull<POLICY>(data, lower, upper);
+
+		// the smaller side is taken next, so the stack holds at most log2(len) ranges
+		if(lower - first < last - upper)
+		{
+			stack.push(std::make_pair(upper, last));
+			stack.push(std::make_pair(first, lower));
+		}
+		else
+		{
+			stack.push(std::make_pair(first, lower));
+			stack.push(std::make_pair(upper, last));
+		}
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator pdq(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::stack<PdqRange> stack;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	stack.push({0, len, floorLog2(len), true});
+	while(!stack.empty())
+	{
+		PdqRange range = stack.top();
+		stack.pop();
+
+		// the lower part of each partition is pushed, the upper one is sorted right away
+		while(true)
+		{
+			const size_t size = range.last - range.first;
+			if(size < PDQ_INSERTION)
+			{
+				SORTVIS_NESTED(insertionRange<POLICY>(data, range.first, range.last));
+				markFull<POLICY>(data, range.first, range.last);
+				break;
+			}
+
+			SORTVIS_NESTED(choosePivot<POLICY>(data, range.first, range.last));
+
+			// a pivot equal to the one before the range is its minimum, all elements equal to it are done
+			if(!range.leftmost)
+			{
+				const bool isLess = data->less(range.first - 1, range.first);
+				SORTVIS_STEP(COMP_MAGIC_VALUE);
+				data->state(sortvis::Sortable::AccessState::None, range.first - 1, range.first);
+
+				if(!isLess)
+				{
+					size_t pivot = 0;
+					SORTVIS_NESTED(partitionLeft<POLICY>(data, range.first, range.last, pivot));
+					markFull<POLICY>(data, range.first, pivot + 1);
+					range.first = pivot + 1;
+					continue;
+				}
+			}
+
+			size_t pivot = 0;
+			bool alreadyPartitioned = false;
+			SORTVIS_NESTED(partitionRight<POLICY>(data, range.first, range.last, pivot, alreadyPartitioned));
+			data->state(sortvis::Sortable::SortState::Full, pivot);
+
+			const size_t lower = pivot - range.first;
+			const size_t upper = range.last - pivot - 1;
+			bool lowerSorted = false;
+			bool upperSorted = false;
+			if(lower < size / 8 || upper < size / 8)
+			{
+				// the pivot already is in its final position and marked, only the partitions are left
+				if(--range.badAllowed == 0)
+				{
+					SORTVIS_NESTED(heapRange<POLICY>(data, range.first, pivot));
+					markFull<POLICY>(data, range.first, pivot);
+					SORTVIS_NESTED(heapRange<POLICY>(data, pivot + 1, range.last));
+					markFull<POLICY>(data, pivot + 1, range.last);
+					break;
+				}
+				if(lower >= PDQ_INSERTION)
+				{
+					SORTVIS_NESTED(breakPatterns<POLICY>(data, range.first, pivot));
+				}
+				if(upper >= PDQ_INSERTION)
+				{
+					SORTVIS_NESTED(breakPatterns<POLICY>(data, pivot + 1, range.last));
+				}
+			}
+			else if(alreadyPartitioned)
+			{
+				SORTVIS_NESTED(partialInsertion<POLICY>(data, range.first, pivot, lowerSorted));
+				SORTVIS_NESTED(partialInsertion<POLICY>(data, pivot + 1, range.last, upperSorted));
+			}
+
+			if(lowerSorted)
+			{
+				markFull<POLICY>(data, range.first, pivot);
+			}
+			else
+			{
+				stack.push({range.first, pivot, range.badAllowed, range.leftmost});
+			}
+			if(upperSorted)
+			{
+				markFull<POLICY>(data, pivot + 1, range.last);
+				break;
+			}
+			range = {pivot + 1, range.last, range.badAllowed, false};
+		}
+	}
+}
+
+/**
+ * @brief inserts [sorted, last) into the sorted [first, sorted), the position is found by binary search
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator binaryInsertion(typename POLICY::Data data, size_t first, size_t sorted, size_t last)
+{
+	for(size_t i = sorted; i < last; ++i)
+	{
+		size_t lo = first;
+		size_t hi = i;
+		while(lo < hi)
+		{
+			const size_t mid = lo + (hi - lo) / 2;
+			const bool isLess = data->less(i, mid);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i, mid);
+
+			if(isLess)
+			{
+				hi = mid;
+			}
+			else
+			{
+				lo = mid + 1;
+			}
+		}
+		for(size_t k = i; k > lo; --k)
+		{
+			data->swap(k - 1, k);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, k - 1, k);
+		}
+	}
+}
+
+/**
+ * @brief counts the leading elements of the sorted [first, last) of buffer that are smaller than key,
+ * or the trailing ones that are larger if fromEnd, by probing 1, 3, 7, ... elements from that end
+ * and a binary search of the last interval
+ *
+ * @param inclusive count elements equal to key too
+ * @param count receives the number of elements
+ */
+template<typename POLICY>
+typename POLICY::Generator gallop(typename POLICY::Data data, size_t buffer, size_t first, size_t last, int key,
+    bool fromEnd, bool inclusive, size_t& count)
+{
+	const auto at = [=](size_t offset)
+	{
+		return fromEnd ? last - 1 - offset : first + offset;
+	};
+	const auto counted = [=](int value)
+	{
+		return fromEnd ? (value > key || (inclusive && value == key)) : (value < key || (inclusive && value == key));
+	};
+
+	size_t lo = 0;
+	size_t hi = last - first;
+	for(size_t probe = 1; probe <= last - first; probe = 2 * probe + 1)
+	{
+		const int value = data->read(buffer, at(probe - 1));
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->bufferState(buffer, sortvis::Sortable::AccessState::None, at(probe - 1));
+
+		if(!counted(value))
+		{
+			hi = probe - 1;
+			break;
+		}
+		lo = probe;
+	}
+	while(lo < hi)
+	{
+		const size_t mid = lo + (hi - lo) / 2;
+		const int value = data->read(buffer, at(mid));
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->bufferState(buffer, sortvis::Sortable::AccessState::None, at(mid));
+
+		if(counted(value))
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+	count = lo;
+}
+
+/**
+ * @brief merges the adjacent runs [first, middle) & [middle, last) front to back with the lower run
+ * in an aux array, gallops once one run supplied minGallop elements in a row
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator timMergeLo(
+    typename POLICY::Data data, size_t first, size_t middle, size_t last, size_t& minGallop)
+{
+	constexpr size_t MAIN = sortvis::SortableCollection::MAIN_BUFFER;
+	const size_t lower = middle - first;
+	const size_t aux = data->allocate(lower);
+	SORTVIS_NESTED(copyRun<POLICY>(data, MAIN, first, aux, 0, lower));
+
+	size_t a = 0;
+	size_t b = middle;
+	size_t k = first;
+	int left = data->read(aux, a);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->bufferState(aux, sortvis::Sortable::AccessState::None, a);
+	int right = data->read(b);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, b);
+
+	// once the lower run is used up the rest of the upper run already is in place
+	size_t winsA = 0;
+	size_t winsB = 0;
+	while(a < lower)
+	{
+		if(b == last)
+		{
+			SORTVIS_NESTED(copyRun<POLICY>(data, aux, a, MAIN, k, lower - a));
+			break;
+		}
+		if(winsA < minGallop && winsB < minGallop)
+		{
+			const bool takeRight = right < left;
+			data->write(k, takeRight ? right : left);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, k);
+
+			++k;
+			winsA = takeRight ? 0 : winsA + 1;
+			winsB = takeRight ? winsB + 1 : 0;
+			if(takeRight && ++b < last)
+			{
+				right = data->read(b);
+				SORTVIS_STEP(COMP_MAGIC_VALUE);
+				data->state(sortvis::Sortable::AccessState::None, b);
+			}
+			else if(!takeRight && ++a < lower)
+			{
+				left = data->read(aux, a);
+				SORTVIS_STEP(COMP_MAGIC_VALUE);
+				data->bufferState(aux, sortvis::Sortable::AccessState::None, a);
+			}
+			continue;
+		}
+
+		size_t countA = 0;
+		SORTVIS_NESTED(gallop<POLICY>(data, aux, a, lower, right, false, true, countA));
+		SORTVIS_NESTED(copyRun<POLICY>(data, aux, a, MAIN, k, countA));
+		a += countA;
+		k += countA;
+		if(a == lower)
+		{
+			break;
+		}
+		left = data->read(aux, a);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->bufferState(aux, sortvis::Sortable::AccessState::None, a);
+
+		size_t countB = 0;
+		SORTVIS_NESTED(gallop<POLICY>(data, MAIN, b, last, left, false, false, countB));
+		SORTVIS_NESTED(copyRun<POLICY>(data, MAIN, b, MAIN, k, countB));
+		b += countB;
+		k += countB;
+		if(b < last)
+		{
+			right = data->read(b);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, b);
+		}
+
+		winsA = keepGalloping(countA, countB, minGallop) ? minGallop : 0;
+		winsB = 0;
+	}
+	data->release(aux);
+}
+
+/**
+ * @brief merges the adjacent runs [first, middle) & [middle, last) back to front with the upper run
+ * in an aux array, gallops once one run supplied minGallop elements in a row
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator timMergeHi(
+    typename POLICY::Data data, size_t first, size_t middle, size_t last, size_t& minGallop)
+{
+	constexpr size_t MAIN = sortvis::SortableCollection::MAIN_BUFFER;
+	const size_t upper = last - middle;
+	const size_t aux = data->allocate(upper);
+	SORTVIS_NESTED(copyRun<POLICY>(data, MAIN, middle, aux, 0, upper));
+
+	size_t a = middle;
+	size_t b = upper;
+	size_t k = last;
+	int left = data->read(a - 1);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, a - 1);
+	int right = data->read(aux, b - 1);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->bufferState(aux, sortvis::Sortable::AccessState::None, b - 1);
+
+	// once the upper run is used up the rest of the lower run already is in place
+	size_t winsA = 0;
+	size_t winsB = 0;
+	while(b > 0)
+	{
+		if(a == first)
+		{
+			SORTVIS_NESTED(copyRun<POLICY>(data, aux, 0, MAIN, k - b, b));
+			break;
+		}
+		if(winsA < minGallop && winsB < minGallop)
+		{
+			const bool takeLeft = right < left;
+			--k;
+			data->write(k, takeLeft ? left : right);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, k);
+
+			winsA = takeLeft ? winsA + 1 : 0;
+			winsB = takeLeft ? 0 : winsB + 1;
+			if(takeLeft && --a > first)
+			{
+				left = data->read(a - 1);
+				SORTVIS_STEP(COMP_MAGIC_VALUE);
+				data->state(sortvis::Sortable::AccessState::None, a - 1);
+			}
+			else if(!takeLeft && --b > 0)
+			{
+				right = data->read(aux, b - 1);
+				SORTVIS_STEP(COMP_MAGIC_VALUE);
+				data->bufferState(aux, sortvis::Sortable::AccessState::None, b - 1);
+			}
+			continue;
+		}
+
+		size_t countA = 0;
+		SORTVIS_NESTED(gallop<POLICY>(data, MAIN, first, a, right, true, false, countA));
+		SORTVIS_NESTED(copyRun<POLICY>(data, MAIN, a - countA, MAIN, k - countA, countA, true));
+		a -= countA;
+		k -= countA;
+		if(a == first)
+		{
+			continue;
+		}
+		left = data->read(a - 1);
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, a - 1);
+
+		size_t countB = 0;
+		SORTVIS_NESTED(gallop<POLICY>(data, aux, 0, b, left, true, true, countB));
+		SORTVIS_NESTED(copyRun<POLICY>(data, aux, b - countB, MAIN, k - countB, countB));
+		b -= countB;
+		k -= countB;
+		if(b > 0)
+		{
+			right = data->read(aux, b - 1);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->bufferState(aux, sortvis::Sortable::AccessState::None, b - 1);
+		}
+
+		winsA = keepGalloping(countA, countB, minGallop) ? minGallop : 0;
+		winsB = 0;
+	}
+	data->release(aux);
+}
+
+/**
+ * @brief merges runs[run] with runs[run + 1] through an aux array of the shorter one,
+ * elements already in place at both ends are skipped by galloping first
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator timMerge(
+    typename POLICY::Data data, std::vector<TimRun>& runs, size_t run, size_t& minGallop)
+{
+	constexpr size_t MAIN = sortvis::SortableCollection::MAIN_BUFFER;
+	size_t first = runs[run].first;
+	const size_t middle = runs[run].last;
+	size_t last = runs[run + 1].last;
+	runs[run].last = last;
+	runs.erase(runs.begin() + static_cast<std::ptrdiff_t>(run) + 1);
+
+	const int upperFirst = data->read(middle);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, middle);
+	size_t skip = 0;
+	SORTVIS_NESTED(gallop<POLICY>(data, MAIN, first, middle, upperFirst, false, true, skip));
+	first += skip;
+	if(first == middle)
+	{
+		SORTVIS_RETURN;
+	}
+
+	const int lowerLast = data->read(middle - 1);
+	SORTVIS_STEP(COMP_MAGIC_VALUE);
+	data->state(sortvis::Sortable::AccessState::None, middle - 1);
+	size_t keep = 0;
+	SORTVIS_NESTED(gallop<POLICY>(data, MAIN, middle, last, lowerLast, true, true, keep));
+	last -= keep;
+
+	if(middle - first <= last - middle)
+	{
+		SORTVIS_NESTED(timMergeLo<POLICY>(data, first, middle, last, minGallop));
+	}
+	else
+	{
+		SORTVIS_NESTED(timMergeHi<POLICY>(data, first, middle, last, minGallop));
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator tim(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	const size_t minRun = timMinRun(len);
+	std::vector<TimRun> runs;
+	size_t minGallop = TIM_MIN_GALLOP;
+	const auto length = [&runs](size_t run)
+	{
+		return runs[run].last - runs[run].first;
+	};
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	for(size_t start = 0; start < len;)
+	{
+		size_t end = 0;
+		SORTVIS_NESTED(findRun<POLICY>(data, start, end));
+		if(end - start < minRun)
+		{
+			const size_t forced = std::min(start + minRun, len);
+			SORTVIS_NESTED(binaryInsertion<POLICY>(data, start, end, forced));
+			end = forced;
+		}
+		runs.push_back({start, end});
+		start = end;
+
+		// keeps the run lengths on the stack growing faster than the fibonacci numbers from the top down
+		while(runs.size() > 1)
+		{
+			size_t n = runs.size() - 2;
+			if((n > 0 && length(n - 1) <= length(n) + length(n + 1)) ||
+			    (n > 1 && length(n - 2) <= length(n - 1) + length(n)))
+			{
+				n = length(n - 1) < length(n + 1) ? n - 1 : n;
+			}
+			else if(length(n) > length(n + 1))
+			{
+				break;
+			}
+			SORTVIS_NESTED(timMerge<POLICY>(data, runs, n, minGallop));
+		}
+	}
+
+	while(runs.size() > 1)
+	{
+		size_t n = runs.size() - 2;
+		n = n > 0 && length(n - 1) < length(n + 1) ? n - 1 : n;
+		SORTVIS_NESTED(timMerge<POLICY>(data, runs, n, minGallop));
+	}
+
+	markFull<POLICY>(data, 0, len);
+}
+
+/**
+ * @brief sorts every simd::BLOCK elements with a bitonic network, the compare-exchanges of each network step
+ * are issued simd::WIDTH pairs at a time, pairs reaching past the end are skipped as if padded with the largest int
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator bitonicBlocks(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::array<size_t, simd::BLOCK / 2> lhs{};
+	std::array<size_t, simd::BLOCK / 2> rhs{};
+
+	for(size_t block = 0; block < len; block += simd::BLOCK)
+	{
+		const size_t count = std::min(simd::BLOCK, len - block);
+		for(size_t run = 2; run / 2 < count; run *= 2)
+		{
+			// the first step orders mirrored pairs of each run, the following ones pairs at distance half
+			for(size_t half = run / 2; half > 0; half /= 2)
+			{
+				size_t pairs = 0;
+				for(size_t i = 0; i < count; ++i)
+				{
+					const size_t partner = half == run / 2 ? i ^ (run - 1) : i ^ half;
+					if((i & half) == 0 && partner < count)
+					{
+						lhs[pairs] = block + i;
+						rhs[pairs] = block + partner;
+						++pairs;
+					}
+				}
+				for(size_t first = 0; first < pairs; first += simd::WIDTH)
+				{
+					const size_t width = std::min(simd::WIDTH, pairs - first);
+					data->compareExchange(
+					    std::span(lhs).subspan(first, width), std::span(rhs).subspan(first, width));
+					SORTVIS_STEP(COMP_MAGIC_VALUE);
+					for(size_t k = first; k < first + width; ++k)
+					{
+						data->state(sortvis::Sortable::AccessState::None, lhs[k], rhs[k]);
+					}
+				}
+			}
+		}
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator bitonic(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	SORTVIS_NESTED(bitonicBlocks<POLICY>(data));
+
+	// the sorted blocks are merged through an aux array like bottomUpMerge, starting at simd::BLOCK wide runs
+	const size_t aux = data->allocate(len);
+	size_t source = sortvis::SortableCollection::MAIN_BUFFER;
+	size_t target = aux;
+	for(size_t width = simd::BLOCK; width < len; width *= 2)
+	{
+		for(size_t lo = 0; lo < len; lo += 2 * width)
+		{
+			if(lo + width < len)
+			{
+				SORTVIS_NESTED(
+				    mergeThrough<POLICY>(data, source, target, lo, lo + width, std::min(lo + 2 * width, len)));
+			}
+			else
+			{
+				SORTVIS_NESTED(copyRun<POLICY>(data, source, lo, target, lo, len - lo));
+			}
+		}
+		std::swap(source, target);
+	}
+
+	if(source == aux)
+	{
+		SORTVIS_NESTED(copyRun<POLICY>(data, aux, 0, sortvis::SortableCollection::MAIN_BUFFER, 0, len));
+	}
+	data->release(aux);
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator lsdRadix(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::array<std::array<size_t, RADIX>, KEY_DIGITS> counts{};
+	uint32_t firstKey = 0;
+	uint32_t varying = 0;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	// a single pass counts all digits and finds the bits in which any key differs from the first one
+	for(size_t i = 0; i < len; ++i)
+	{
+		const uint32_t key = radixKey(data->read(i));
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i);
+
+		firstKey = i == 0 ? key : firstKey;
+		varying |= key ^ firstKey;
+		for(size_t digit = 0; digit < KEY_DIGITS; ++digit)
+		{
+			++counts[digit][radixDigit(key, digit)];
+		}
+	}
+
+	const size_t aux = data->allocate(len);
+	size_t source = sortvis::SortableCollection::MAIN_BUFFER;
+	size_t target = aux;
+	for(size_t digit = 0; digit < KEY_DIGITS; ++digit)
+	{
+		if(radixDigit(varying, digit) == 0)
+		{
+			continue;
+		}
+
+		std::array<size_t, RADIX> offsets{};
+		std::exclusive_scan(counts[digit].begin(), counts[digit].end(), offsets.begin(), size_t(0));
+		for(size_t i = 0; i < len; ++i)
+		{
+			const int value = data->read(source, i);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->bufferState(source, sortvis::Sortable::AccessState::None, i);
+
+			const size_t slot = offsets[radixDigit(radixKey(value), digit)]++;
+			data->write(target, slot, value);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->bufferState(target, sortvis::Sortable::AccessState::None, slot);
+		}
+		std::swap(source, target);
+	}
+
+	if(source == aux)
+	{
+		for(size_t i = 0; i < len; ++i)
+		{
+			const int value = data->read(aux, i);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->bufferState(aux, sortvis::Sortable::AccessState::None, i);
+
+			data->write(i, value);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i);
+		}
+	}
+	data->release(aux);
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+template<typename POLICY>
+typename POLICY::Generator msdRadix(typename POLICY::Data data)
+{
+	const size_t len = data->size();
+	std::stack<RadixBucket> stack;
+	uint32_t firstKey = 0;
+	uint32_t varying = 0;
+
+	SORTVIS_STEP(INIT_MAGIC_VALUE);
+
+	for(size_t i = 0; i < len; ++i)
+	{
+		const uint32_t key = radixKey(data->read(i));
+		SORTVIS_STEP(COMP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, i);
+
+		firstKey = i == 0 ? key : firstKey;
+		varying |= key ^ firstKey;
+	}
+
+	if(varying == 0)
+	{
+		for(size_t i = 0; i < len; ++i)
+		{
+			data->state(sortvis::Sortable::SortState::Full, i);
+		}
+		SORTVIS_RETURN;
+	}
+
+	const size_t aux = data->allocate(len);
+	stack.push({0, len, (static_cast<size_t>(std::bit_width(varying)) - 1) / RADIX_BITS});
+	while(!stack.empty())
+	{
+		const RadixBucket bucket = stack.top();
+		stack.pop();
+
+		if(bucket.last - bucket.first < MSD_CUTOFF)
+		{
+			SORTVIS_NESTED(insertionRange<POLICY>(data, bucket.first, bucket.last));
+			for(size_t i = bucket.first; i < bucket.last; ++i)
+			{
+				data->state(sortvis::Sortable::SortState::Full, i);
+			}
+			continue;
+		}
+
+		// counts all remaining digits at once, so digits that are constant across the bucket can be skipped
+		std::array<std::array<size_t, RADIX>, KEY_DIGITS> counts{};
+		uint32_t bucketKey = 0;
+		uint32_t bucketVarying = 0;
+		for(size_t i = bucket.first; i < bucket.last; ++i)
+		{
+			const uint32_t key = radixKey(data->read(i));
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i);
+
+			bucketKey = i == bucket.first ? key : bucketKey;
+			bucketVarying |= key ^ bucketKey;
+			for(size_t digit = 0; digit <= bucket.digit; ++digit)
+			{
+				++counts[digit][radixDigit(key, digit)];
+			}
+		}
+
+		size_t digit = bucket.digit + 1;
+		while(digit-- > 0 && radixDigit(bucketVarying, digit) == 0) {}
+		if(digit > bucket.digit)
+		{
+			for(size_t i = bucket.first; i < bucket.last; ++i)
+			{
+				data->state(sortvis::Sortable::SortState::Full, i);
+			}
+			continue;
+		}
+
+		std::array<size_t, RADIX + 1> bounds{};
+		bounds[0] = bucket.first;
+		std::inclusive_scan(
+		    counts[digit].begin(), counts[digit].end(), bounds.begin() + 1, std::plus<>(), bucket.first);
+		std::array<size_t, RADIX> offsets{};
+		std::copy_n(bounds.begin(), RADIX, offsets.begin());
+
+		for(size_t i = bucket.first; i < bucket.last; ++i)
+		{
+			const int value = data->read(i);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i);
+
+			const size_t slot = offsets[radixDigit(radixKey(value), digit)]++;
+			data->write(aux, slot, value);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->bufferState(aux, sortvis::Sortable::AccessState::None, slot);
+		}
+		for(size_t i = bucket.first; i < bucket.last; ++i)
+		{
+			const int value = data->read(aux, i);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->bufferState(aux, sortvis::Sortable::AccessState::None, i);
+
+			data->write(i, value);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, i);
+		}
+
+		// pushed in reverse to sort the smallest digits first
+		for(size_t value = RADIX; value-- > 0;)
+		{
+			if(bounds[value + 1] - bounds[value] > 1 && digit > 0)
+			{
+				stack.push({bounds[value], bounds[value + 1], digit - 1});
+			}
+			else
+			{
+				for(size_t i = bounds[value]; i < bounds[value + 1]; ++i)
+				{
+					data->state(sortvis::Sortable::SortState::Full, i);
+				}
+			}
+		}
+	}
+	data->release(aux);
+}
+
+/**
+ * @brief moves an evenly spaced sample of samples elements to the end and sorts it,
+ * then moves every (samples / buckets)th sample, the buckets - 1 splitters, to the last buckets - 1 indices
+ *
+ */
+template<typename POLICY>
+typename POLICY::Generator gatherSplitters(typename POLICY::Data data, size_t samples, size_t buckets)
+{
+	const size_t len = data->size();
+	const size_t sampleFirst = len - samples;
+	for(size_t i = samples; i-- > 0;)
+	{
+		const size_t source = i * len / samples;
+		if(source != sampleFirst + i)
+		{
+			data->swap(source, sampleFirst + i);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, source, sampleFirst + i);
+		}
+	}
+
+	SORTVIS_NESTED(insertionRange<POLICY>(data, sampleFirst, len));
+
+	const size_t oversampling = samples / buckets;
+	for(size_t k = buckets - 1; k > 0; --k)
+	{
+		const size_t splitter = sampleFirst + k * oversampling - 1;
+		const size_t target = len - buckets + k;
+		if(splitter != target)
+		{
+			data->swap(splitter, target);
+			SORTVIS_STEP(SWAP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, splitter, target);
+		}
+	}
+}
+
+/**
+ * @brief partitions all elements into those less than the shared pivot followed by the rest
+ *
+ * @param pivot absolute index of the pivot, outside of every running lane
+ * @param split receives the index of the first element not less than pivot
+ */
+template<typename POLICY>
+typename POLICY::Generator partitionShared(typename POLICY::Data data, size_t pivot, size_t& split)
+{
+	size_t lo = 0;
+	size_t hi = data->size();
+	while(true)
+	{
+		while(lo < hi)
+		{
+			const bool isLess = data->lessThanShared(lo, pivot);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, lo);
+
+			if(!isLess)
+			{
+				break;
+			}
+			++lo;
+		}
+		while(lo < hi)
+		{
+			const bool isLess = data->lessThanShared(hi - 1, pivot);
+			SORTVIS_STEP(COMP_MAGIC_VALUE);
+			data->state(sortvis::Sortable::AccessState::None, hi - 1);
+
+			if(isLess)
+			{
+				break;
+			}
+			--hi;
+		}
+		if(lo >= hi)
+		{
+			break;
+		}
+
+		data->swap(lo, hi - 1);
+		SORTVIS_STEP(SWAP_MAGIC_VALUE);
+		data->state(sortvis::Sortable::AccessState::None, lo, hi - 1);
+
+		++lo;
+		--hi;
+	}
+	split = lo;
+}
+
+/**
+ * @brief moves the splitters from the end between the distributed buckets & marks them as sorted
+ *
+ * @param bounds bucket k holds the elements [bounds[k], bounds[k + 1]), the splitters follow the last bucket
+ */
+template<typename POLICY>
+typename POLICY::Generator placeSplitters(typename POLICY::Data data, std::vector<size_t> bounds)
+{
+	for(size_t k = bounds.size() - 2; k > 0; --k)
+	{
+		const size_t first = bounds[k];
+		const size_t last = bounds[k + 1];
+		if(last - first >= k)
+		{
+			SORTVIS_NESTED(swapBlocks<POLICY>(data, first, last, k));
+		}
+		else
+		{
+			SORTVIS_NESTED(rotate<POLICY>(data, first, last, last + k));
+		}
+		data->state(sortvis::Sortable::AccessState::None, first + k - 1);
+		data->state(sortvis::Sortable::SortState::Full, first + k - 1);
+	}
+}
@@ -0,0 +1,360 @@
+#include "distribution.hpp"
+#include "thread-pool.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace sortvis
+{
+namespace
+{
+constexpr size_t CHUNK = size_t(1) << 16; //! elements per parallel task & about per shuffle bucket
+
+/**
+ * @brief independent streams of a CounterRng for the different uses
+ *
+ */
+enum Stream : uint64_t
+{
+	BUCKET = 1,
+	SHUFFLE = 2,
+	SWAP = 3,
+	VALUE = 4
+};
+
+/**
+ * @brief calls task(idx) for every idx in [0, count), spread over pool if there is one
+ *
+ */
+template<typename TASK>
+void forEachTask(sortvis::ThreadPool* pool, size_t count, TASK&& task)
+{
+	if(pool == nullptr || count < 2)
+	{
+		for(size_t idx = 0; idx < count; ++idx)
+		{
+			task(idx);
+		}
+		return;
+	}
+	pool->run(count, task);
+}
+
+/**
+ * @brief calls fill(first, last) for consecutive ranges of at most CHUNK elements covering [0, elements)
+ *
+ */
+template<typename FILL>
+void forEachChunk(sortvis::ThreadPool* pool, size_t elements, FILL&& fill)
+{
+	forEachTask(pool, (elements + CHUNK - 1) / CHUNK,
+	    [&](size_t chunk)
+	    {
+		    fill(chunk * CHUNK, std::min(elements, (chunk + 1) * CHUNK));
+	    });
+}
+
+/**
+ * @brief calls visit(idx, bucket) for every idx in [first, last) with its random bucket in [0, buckets),
+ * each block of the rng supplies the buckets of 4 consecutive elements, first has to be a multiple of 4
+ *
+ */
+template<typename VISIT>
+void forEachBucket(const sortvis::CounterRng& rng, size_t buckets, size_t first, size_t last, VISIT&& visit)
+{
+	for(size_t i = first; i < last; i += 4)
+	{
+		const std::array<uint32_t, 4> bits = rng.block(i / 4, Stream::BUCKET);
+		for(size_t lane = 0; lane < 4 && i + lane < last; ++lane)
+		{
+			visit(i + lane, (uint64_t(bits[lane]) * buckets) >> 32);
+		}
+	}
+}
+
+/**
+ * @brief uniformly random permutation of [1, size] (Sanders 1998),
+ * every element goes into a random bucket, then each bucket is shuffled by itself,
+ * both steps run in parallel & chunks and buckets do not depend on the number of threads
+ *
+ */
+void shuffle(std::span<int> values, const sortvis::CounterRng& rng, sortvis::ThreadPool* pool)
+{
+	const size_t elements = values.size();
+	const size_t chunks = (elements + CHUNK - 1) / CHUNK;
+	const size_t buckets = std::max(chunks, size_t(1));
+
+	// offsets[chunk * buckets + bucket] is where the chunk writes its first element of bucket
+	std::vector<size_t> offsets(chunks * buckets + 1, 0);
+	forEachChunk(pool, elements,
+	    [&](size_t first, size_t last)
+	    {
+		    size_t* counts = offsets.data() + first / CHUNK * buckets;
+		    forEachBucket(rng, buckets, first, last,
+		        [counts](size_t, size_t bucket)
+		        {
+			        ++counts[bucket];
+		        });
+	    });
+
+	std::vector<size_t> bucketFirst(buckets + 1, 0);
+	size_t total = 0;
+	for(size_t bucket = 0; bucket < buckets; ++bucket)
+	{
+		bucketFirst[bucket] = total;
+		for(size_t chunk = 0; chunk < chunks; ++chunk)
+		{
+			total += std::exchange(offsets[chunk * buckets + bucket], total);
+		}
+	}
+	bucketFirst[buckets] = total;
+
+	std::vector<int> scattered(elements);
+	forEachChunk(pool, elements,
+	    [&](size_t first, size_t last)
+	    {
+		    size_t* next = offsets.data() + first / CHUNK * buckets;
+		    forEachBucket(rng, buckets, first, last,
+		        [next, &scattered](size_t i, size_t bucket)
+		        {
+			        scattered[next[bucket]++] = static_cast<int>(i + 1);
+		        });
+	    });
+
+	forEachTask(pool, buckets,
+	    [&](size_t bucket)
+	    {
+		    // Fisher-Yates, each block of the rng supplies two 64 bit numbers
+		    const size_t first = bucketFirst[bucket];
+		    std::array<uint32_t, 4> bits{};
+		    for(size_t i = bucketFirst[bucket + 1]; i > first + 1; --i)
+		    {
+			    const size_t lane = (i - 1) % 2 * 2;
+			    if(lane == 2 || i == bucketFirst[bucket + 1])
+			    {
+				    bits = rng.block((i - 1) / 2, Stream::SHUFFLE);
+			    }
+			    const uint64_t random = (uint64_t(bits[lane + 1]) << 32) | bits[lane];
+			    std::swap(scattered[i - 1], scattered[first + random % (i - first)]);
+		    }
+		    std::copy(scattered.begin() + static_cast<std::ptrdiff_t>(first),
+		        scattered.begin() + static_cast<std::ptrdiff_t>(bucketFirst[bucket + 1]),
+		        values.begin() + static_cast<std::ptrdiff_t>(first));
+	    });
+}
+
+/**
+ * @brief draws integers in [1, count] with a probability proportional to 1 / k^exponent
+ * by rejection inversion (Hoermann & Derflinger 1996), constant time per value without tables
+ *
+ */
+class ZipfSampler
+{
+private:
+	double exponent;
+	double count;
+	double hIntegralX1;
+	double hIntegralCount;
+	double squeeze;
+
+	/**
+	 * @return double log(1 + x) / x, 1 at 0
+	 */
+	static double log1pRatio(double x) noexcept
+	{
+		return std::abs(x) > 1e-8 ? std::log1p(x) / x : 1.0 - x / 2.0;
+	}
+
+	/**
+	 * @return double (exp(x) - 1) / x, 1 at 0
+	 */
+	static double expm1Ratio(double x) noexcept
+	{
+		return std::abs(x) > 1e-8 ? std::expm1(x) / x : 1.0 + x / 2.0;
+	}
+
+	[[nodiscard]] double h(double x) const noexcept
+	{
+		return std::exp(-exponent * std::log(x));
+	}
+
+	[[nodiscard]] double hIntegral(double x) const noexcept
+	{
+		const double logX = std::log(x);
+		return expm1Ratio((1.0 - exponent) * logX) * logX;
+	}
+
+	[[nodiscard]] double hIntegralInverse(double x) const noexcept
+	{
+		const double t = std::max(x * (1.0 - exponent), -1.0);
+		return std::exp(log1pRatio(t) * x);
+	}
+
+public:
+	ZipfSampler(size_t elements, double zipfExponent) noexcept :
+	    exponent{zipfExponent},
+	    count{static_cast<double>(elements)},
+	    hIntegralX1{hIntegral(1.5) - 1.0},
+	    hIntegralCount{hIntegral(count + 0.5)},
+	    squeeze{2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0))}
+	{
+	}
+
+	/**
+	 * @return size_t value of element idx, uses as many streams of rng as attempts are needed
+	 */
+	[[nodiscard]] size_t operator()(const sortvis::CounterRng& rng, size_t idx) const noexcept
+	{
+		for(uint64_t attempt = 0;; ++attempt)
+		{
+			const double u =
+			    hIntegralCount + rng.unit(idx, Stream::VALUE + (attempt << 8)) * (hIntegralX1 - hIntegralCount);
+			const double x = hIntegralInverse(u);
+			const double k = std::clamp(std::floor(x + 0.5), 1.0, count);
+			if(k - x <= squeeze || u >= hIntegral(k + 0.5) - h(k))
+			{
+				return static_cast<size_t>(k);
+			}
+		}
+	}
+};
+} // namespace
+
+void generate(std::span<int> values, sortvis::Distribution distribution, uint64_t seed,
+    const sortvis::DistributionParameters& parameters, sortvis::ThreadPool* pool)
+{
+	const sortvis::CounterRng rng(seed);
+	const size_t elements = values.size();
+	const size_t defaultPeriod = static_cast<size_t>(std::sqrt(static_cast<double>(elements)));
+	const size_t period = std::max(parameters.period == 0 ? defaultPeriod : parameters.period, size_t(1));
+
+	switch(distribution)
+	{
+	case sortvis::Distribution::Random:
+		shuffle(values, rng, pool);
+		break;
+	case sortvis::Distribution::Sorted:
+		std::iota(values.begin(), values.end(), 1);
+		break;
+	case sortvis::Distribution::NearlySorted:
+	{
+		std::iota(values.begin(), values.end(), 1);
+		const size_t swaps = parameters.swaps == 0 ? elements / 100 : parameters.swaps;
+		for(size_t swap = 0; swap < swaps && elements > 1; ++swap)
+		{
+			std::swap(values[rng.below(elements, 2 * swap, Stream::SWAP)],
+			    values[rng.below(elements, 2 * swap + 1, Stream::SWAP)]);
+		}
+		break;
+	}
+	case sortvis::Distribution::Reversed:
+		forEachChunk(pool, elements,
+		    [&](size_t first, size_t last)
+		    {
+			    for(size_t i = first; i < last; ++i)
+			    {
+				    values[i] = static_cast<int>(elements - i);
+			    }
+		    });
+		break;
+	case sortvis::Distribution::Sawtooth:
+		forEachChunk(pool, elements,
+		    [&](size_t first, size_t last)
+		    {
+			    for(size_t i = first; i < last; ++i)
+			    {
+				    values[i] = static_cast<int>(1 + i % period * elements / period);
+			    }
+		    });
+		break;
+	case sortvis::Distribution::FewUnique:
+	{
+		const size_t unique = std::max(parameters.unique, size_t(1));
+		forEachChunk(pool, elements,
+		    [&](size_t first, size_t last)
+		    {
+			    for(size_t i = first; i < last; ++i)
+			    {
+				    values[i] = static_cast<int>(1 + rng.below(unique, i, Stream::VALUE) * elements / unique);
+			    }
+		    });
+		break;
+	}
+	case sortvis::Distribution::Zipf:
+	{
+		const ZipfSampler sampler(elements, parameters.zipfExponent);
+		forEachChunk(pool, elements,
+		    [&](size_t first, size_t last)
+		    {
+			    for(size_t i = first; i < last; ++i)
+			    {
+				    values[i] = static_cast<int>(sampler(rng, i));
+			    }
+		    });
+		break;
+	}
+	case sortvis::Distribution::OrganPipe:
+		forEachChunk(pool, elements,
+		    [&](size_t first, size_t last)
+		    {
+			    for(size_t i = first; i < last; ++i)
+			    {
+				    values[i] = static_cast<int>(2 * i < elements ? 2 * i + 1 : 2 * (elements - i));
+			    }
+		    });
+		break;
+	case sortvis::Distribution::Runs:
+		shuffle(values, rng, pool);
+		forEachTask(pool, (elements + period - 1) / period,
+		    [&](size_t run)
+		    {
+			    const auto first = values.begin() + static_cast<std::ptrdiff_t>(run * period);
+			    std::sort(first, first + static_cast<std::ptrdiff_t>(std::min(period, elements - run * period)));
+		    });
+		break;
+	}
+}
+
+uint64_t freshSeed()
+{
+	static const uint64_t base = []
+	{
+		std::random_device device;
+		return (uint64_t(device()) << 32) | device();
+	}();
+	static std::atomic<uint64_t> calls{0};
+	return sortvis::CounterRng(base)(calls++);
+}
+
+const char* getDistributionName(sortvis::Distribution distribution) noexcept
+{
+	switch(distribution)
+	{
+	case sortvis::Distribution::Random:
+		return "random";
+	case sortvis::Distribution::Sorted:
+		return "sorted";
+	case sortvis::Distribution::NearlySorted:
+		return "nearly sorted";
+	case sortvis::Distribution::Reversed:
+		return "reversed";
+	case sortvis::Distribution::Sawtooth:
+		return "sawtooth";
+	case sortvis::Distribution::FewUnique:
+		return "few unique";
+	case sortvis::Distribution::Zipf:
+		return "zipf";
+	case sortvis::Distribution::OrganPipe:
+		return "organ pipe";
+	case sortvis::Distribution::Runs:
+		return "runs";
+	}
+	return "UNKNOWN";
+}
+} // namespace sortvis
@@ -13,12 +13,12 @@ constexpr auto PLOT =
 constexpr auto LEGEND =
     static_cast<ImPlotLegendFlags_>(ImPlotLegendFlags_NoHighlightAxis | ImPlotLegendFlags_NoHighlightItem |
                                     ImPlotLegendFlags_Horizontal | ImPlotLegendFlags_Outside);
-constexpr auto YAXIS =
-    static_cast<ImPlotAxisFlags_>(ImPlotAxisFlags_AutoFit | ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoHighlight);
+constexpr auto YAXIS = static_cast<ImPlotAxisFlags_>(ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoHighlight);
 constexpr auto XAXIS = static_cast<ImPlotAxisFlags_>(YAXIS | ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_NoTickMarks);
 constexpr auto SORTER = static_cast<ImGuiWindowFlags_>(ImGuiWindowFlags_NoInputs | ImGuiWindowFlags_NoDecoration);
 constexpr auto SETTINGS = static_cast<ImGuiWindowFlags_>(ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove);
 constexpr auto DELAY = ImGuiSliderFlags_::ImGuiSliderFlags_Logarithmic;
+constexpr auto ELEMENTS = ImGuiSliderFlags_::ImGuiSliderFlags_Logarithmic;
 } // namespace flags
 
 using RGBcolor = uint32_t;
@@ -39,54 +39,197 @@ constexpr RGBcolor ROYAL_BLUE = 0x4169E1;
 constexpr RGBcolor FOREST_GREEN = 0x228B22;
 constexpr RGBcolor GOLDEN_ROD = 0xDAA520;
 constexpr RGBcolor FIRE_BRICK = 0xB22222;
+constexpr RGBcolor SLATE_GRAY = 0x708090;
+constexpr RGBcolor WHITE_SMOKE = 0xF5F5F5;
 
 /**
- * @brief filtered getter for plotting SortableCollection
+ * @brief colors of sortvis::BarColumns::Display, in the same order
  *
- * @tparam STATE_A SortableState to filter for
- * @tparam STATE_B SortableState to filter for
- * @param data void* to SortableCollection
- * @param idx index
- * @return ImPlotPoint for bar if states match or {0,0}
  */
-template<auto STATE_A, auto STATE_B = STATE_A>
-    requires sortvis::SortableState<decltype(STATE_A)> && sortvis::SortableState<decltype(STATE_B)>
-ImPlotPoint genericGetter(int idx, void* data) noexcept
+constexpr std::array<RGBcolor, sortvis::BarColumns::DISPLAY_COUNT> DISPLAY_COLORS{
+    FIRE_BRICK, GOLDEN_ROD, FOREST_GREEN, ROYAL_BLUE};
+
+/**
+ * @brief adds a legend entry without plotting anything
+ *
+ * @param label
+ * @param color
+ */
+void plotLegend(const sortvis::NumberedString& label, RGBcolor color)
+{
+	ImPlot::SetNextLineStyle(fromRGB(color));
+	ImPlot::PlotDummy(label.data());
+}
+
+constexpr float FADED_ALPHA = 0.35f;
+
+/**
+ * @brief draws count bars spread over elements into the current plot in a single pass,
+ * each one solid up to the min of its column & faded from there up to the max
+ *
+ * @param elements number of elements on the x axis
+ * @param count number of bars
+ * @param maxValue value at the top of the plot
+ * @param quad called with the index of a bar, returns its sortvis::BarColumns::Column
+ */
+template<typename QUAD>
+void drawQuads(size_t elements, size_t count, double maxValue, QUAD quad)
 {
-	const auto& collection = *static_cast<sortvis::SortableCollection*>(data);
-	const auto& element = collection[idx];
-	if(element == STATE_A && element == STATE_B)
+	std::array<ImU32, sortvis::BarColumns::DISPLAY_COUNT> colors{};
+	std::array<ImU32, sortvis::BarColumns::DISPLAY_COUNT> faded{};
+	for(size_t display = 0; display < DISPLAY_COLORS.size(); ++display)
+	{
+		ImVec4 color = fromRGB(DISPLAY_COLORS[display]);
+		colors[display] = ImGui::GetColorU32(color);
+		color.w = FADED_ALPHA;
+		faded[display] = ImGui::GetColorU32(color);
+	}
+
+	const ImVec2 bottomLeft = ImPlot::PlotToPixels(-0.5, 0.0);
+	const ImVec2 topRight = ImPlot::PlotToPixels(static_cast<double>(elements) - 0.5, maxValue);
+	const auto pixelHeight = static_cast<float>((topRight.y - bottomLeft.y) / maxValue);
+	const float width = (topRight.x - bottomLeft.x) / static_cast<float>(count);
+
+	ImDrawList* drawList = ImPlot::GetPlotDrawList();
+	drawList->PrimReserve(static_cast<int>(count * 12), static_cast<int>(count * 8));
+	for(size_t idx = 0; idx < count; ++idx)
 	{
-		return {static_cast<double>(idx), static_cast<double>(element.value)};
+		const sortvis::BarColumns::Column column = quad(idx);
+		const auto display = static_cast<size_t>(column.display);
+		const float left = bottomLeft.x + static_cast<float>(idx) * width;
+		const float minTop = bottomLeft.y + static_cast<float>(column.min) * pixelHeight;
+		drawList->PrimRect(ImVec2(left, minTop), ImVec2(left + width, bottomLeft.y), colors[display]);
+		drawList->PrimRect(ImVec2(left, bottomLeft.y + static_cast<float>(column.max) * pixelHeight),
+		    ImVec2(left + width, minTop), faded[display]);
 	}
-	return {0, 0};
 }
-constexpr auto writeGetter = genericGetter<sortvis::Sortable::AccessState::Write>;
-constexpr auto readGetter = genericGetter<sortvis::Sortable::AccessState::Read>;
-constexpr auto fullGetter = genericGetter<sortvis::Sortable::AccessState::None, sortvis::Sortable::SortState::Full>;
-constexpr auto noneGetter = genericGetter<sortvis::Sortable::AccessState::None, sortvis::Sortable::SortState::None>;
 
 /**
- * @brief helper function to plot SortableCollection
+ * @brief draws the bars of a Sorter into the current plot in a single pass,
+ * one quad per element or per BarColumns column if there are more elements than pixel columns,
+ * followed by a line at the cursor of every worker lane of parallel algorithms
  *
- * @param sorter Sorter to plot
- * @param label
- * @param color
- * @param getter
+ * @param sorter Sorter to draw
+ * @param columns BarColumns of the Sorter
+ * @param pixelColumns available pixel columns
+ * @param maxValue value at the top of the plot
+ */
+void drawBars(const sortvis::Sorter& sorter, sortvis::BarColumns& columns, size_t pixelColumns, double maxValue)
+{
+	const sortvis::SortableCollection& collection = sorter.data();
+
+	ImPlot::PushPlotClipRect();
+
+	if(collection.size() > pixelColumns)
+	{
+		columns.update(sorter, pixelColumns);
+		drawQuads(collection.size(), columns.size(), maxValue,
+		    [&columns](size_t col)
+		    {
+			    return columns[col];
+		    });
+	}
+	else
+	{
+		drawQuads(collection.size(), collection.size(), maxValue,
+		    [&collection](size_t idx)
+		    {
+			    return sortvis::BarColumns::single(collection[idx]);
+		    });
+	}
+
+	const ImVec2 bottomLeft = ImPlot::PlotToPixels(-0.5, 0.0);
+	const ImVec2 topRight = ImPlot::PlotToPixels(static_cast<double>(collection.size()) - 0.5, maxValue);
+	const float elementWidth = (topRight.x - bottomLeft.x) / static_cast<float>(collection.size());
+	const ImU32 cursorColor = ImGui::GetColorU32(fromRGB(WHITE_SMOKE));
+	ImDrawList* drawList = ImPlot::GetPlotDrawList();
+	for(size_t cursor : collection.cursors())
+	{
+		if(cursor != sortvis::SortableCollection::NO_CURSOR)
+		{
+			const float x = bottomLeft.x + (static_cast<float>(cursor) + 0.5f) * elementWidth;
+			drawList->AddLine(ImVec2(x, bottomLeft.y), ImVec2(x, topRight.y), cursorColor);
+		}
+	}
+
+	ImPlot::PopPlotClipRect();
+}
+
+/**
+ * @brief draws an aux array into the current plot, aggregated into pixel columns if it is wider than the plot
+ *
+ * @param aux AuxArray to draw
+ * @param pixelColumns available pixel columns
+ * @param maxValue value at the top of the plot
  */
-void plotBars(const sortvis::Sorter& sorter, const sortvis::NumberedString& label, RGBcolor color,
-    ImPlotPoint (*getter)(int idx, void* data))
+void drawAux(const sortvis::AuxArray& aux, size_t pixelColumns, double maxValue)
 {
-	ImPlot::SetNextFillStyle(fromRGB(color));
-	ImPlot::PlotBarsG(label.data(), getter,
-	    static_cast<void*>(const_cast<sortvis::SortableCollection*>(&sorter.data())),
-	    static_cast<int>(sorter.data().size()), 1.0);
+	ImPlot::PushPlotClipRect();
+
+	if(aux.size() > pixelColumns)
+	{
+		sortvis::BarColumns columns;
+		columns.aggregate(aux, pixelColumns);
+		drawQuads(aux.size(), columns.size(), maxValue,
+		    [&columns](size_t col)
+		    {
+			    return columns[col];
+		    });
+	}
+	else
+	{
+		drawQuads(aux.size(), aux.size(), maxValue,
+		    [&aux](size_t idx)
+		    {
+			    return sortvis::BarColumns::single(aux[idx]);
+		    });
+	}
+
+	ImPlot::PopPlotClipRect();
 }
 
 constexpr int OUTER_BORDER_MARGIN = 14;
 constexpr int INNER_X_BORDER_MARGIN = 8;
 constexpr int INNER_Y_BORDER_MARGIN = 4;
 
+/**
+ * @brief renders the timeline controls of precomputed sorters
+ *
+ * @param data
+ */
+void renderTimeline(sortvis::GUIData& data)
+{
+	if(ImGui::Button("<"))
+	{
+		data.paused = true;
+		data.sorters.stepBack();
+	}
+
+	ImGui::SameLine();
+	if(ImGui::Button(">"))
+	{
+		data.paused = true;
+		data.sorters.advance();
+	}
+
+	ImGui::SameLine();
+	ImGui::Checkbox("pause", &data.paused);
+
+	const ImU64 first = data.sorters.firstStep();
+	const ImU64 recorded = data.sorters.recordedSteps();
+	ImU64 step = data.sorters.step();
+
+	ImGui::SameLine();
+	ImGui::PushItemWidth(-1);
+	if(ImGui::SliderScalar("##step", ImGuiDataType_U64, &step, &first, &recorded))
+	{
+		data.paused = true;
+		data.sorters.seek(static_cast<size_t>(step));
+	}
+}
+
+constexpr float DISTRIBUTION_WIDTH = 120;
+
 /**
  * @brief renders the settings area
  *
@@ -113,23 +256,66 @@ void renderSettings(sortvis::GUIData& data)
 	ImGui::SameLine();
 	ImGui::Checkbox("auto reset", &data.autoReset);
 
-	const float sliderWidth = (ImGui::GetWindowWidth() - 409) / 2;
+	ImGui::SameLine();
+	if(ImGui::Checkbox("precompute", &data.precompute))
+	{
+		data.resetSorters();
+	}
+
+	ImGui::SameLine();
+	if(ImGui::Checkbox("parallel", &data.parallel))
+	{
+		data.sorters.setThreads(data.parallel ? std::thread::hardware_concurrency() : 1);
+	}
+
+	ImGui::SameLine();
+	if(ImGui::Checkbox("cache", &data.simulateCache))
+	{
+		data.updateCacheSimulation();
+		data.resetSorters();
+	}
+
+	static const std::array<const char*, sortvis::DISTRIBUTIONS.size()> distributionNames = []
+	{
+		std::array<const char*, sortvis::DISTRIBUTIONS.size()> names{};
+		std::transform(sortvis::DISTRIBUTIONS.begin(), sortvis::DISTRIBUTIONS.end(), names.begin(),
+		    sortvis::getDistributionName);
+		return names;
+	}();
+
+	ImGui::SameLine();
+	ImGui::PushItemWidth(DISTRIBUTION_WIDTH);
+	if(ImGui::Combo("input", &data.distribution, distributionNames.data(), static_cast<int>(distributionNames.size())))
+	{
+		data.resetSorters();
+	}
+
+	const float sliderWidth = (ImGui::GetWindowWidth() - 730 - DISTRIBUTION_WIDTH) / 2;
 
 	ImGui::SameLine();
 	ImGui::PushItemWidth(sliderWidth);
-	ImGui::SliderFloat("advance delay", &data.advanceDelay, 0.004f, 1.0f, "%.3f", flags::DELAY);
+	ImGui::SliderFloat("advance delay", &data.advanceDelay, 0.00001f, 1.0f, "%.5f", flags::DELAY);
 
 	ImGui::SameLine();
 	ImGui::PushItemWidth(sliderWidth);
-	ImGui::SliderInt("elements", &data.elements, 8, 128);
+	ImGui::SliderInt("elements", &data.elements, 8, 1'000'000, "%d", flags::ELEMENTS);
+
+	if(data.precompute)
+	{
+		renderTimeline(data);
+	}
 
 	data.controlSize = ImGui::GetWindowSize();
 
 	ImGui::End();
 }
 
+constexpr float AUX_PLOT_SHARE = 0.35f;
+
 /**
- * @brief renders the sorters area
+ * @brief renders the sorters area,
+ * collections with more elements than the plot is wide are drawn as one bar per pixel column,
+ * aux arrays of a sorter share the lower part of its cell
  *
  * @todo better handle small window sizes
  *
@@ -148,23 +334,81 @@ void renderSorters(sortvis::GUIData& data)
 	        data.controlSize.y) /
 	        data.sortersPerCol);
 
+	const auto pixelColumns = static_cast<size_t>(std::max(plotSize.x, 1.0f));
+
 	int sorterLineNumber = 0;
+	size_t sorterIdx = 0;
 	for(const sortvis::Sorter& sorter : data.sorters)
 	{
-		if(ImPlot::BeginPlot(sorter.name(), plotSize, flags::PLOT))
+		const std::span<const sortvis::AuxArray> auxiliaries = sorter.data().auxiliaries();
+		const float auxHeight = auxiliaries.empty() ? 0.0f
+		                                            : (plotSize.y * AUX_PLOT_SHARE - INNER_Y_BORDER_MARGIN) /
+		                                                  static_cast<float>(auxiliaries.size());
+
+		ImGui::PushID(static_cast<int>(sorterIdx));
+		ImGui::BeginGroup();
+		const ImVec2 mainSize(plotSize.x, auxiliaries.empty() ? plotSize.y : plotSize.y * (1.0f - AUX_PLOT_SHARE));
+		if(ImPlot::BeginPlot(sorter.name(), mainSize, flags::PLOT))
 		{
 			ImPlot::SetupLegend(ImPlotLocation_::ImPlotLocation_South, flags::LEGEND);
 			ImPlot::SetupAxes("index", "value", flags::XAXIS, flags::YAXIS);
 
+			const auto elements = static_cast<double>(sorter.data().size());
+			ImPlot::SetupAxesLimits(-0.5, elements - 0.5, 0.0, elements, ImPlotCond_Always);
+
 			data.barLabels.update(sorter);
 
-			plotBars(sorter, data.barLabels.write(), FIRE_BRICK, writeGetter);
-			plotBars(sorter, data.barLabels.read(), GOLDEN_ROD, readGetter);
-			plotBars(sorter, data.barLabels.full(), FOREST_GREEN, fullGetter);
-			plotBars(sorter, data.barLabels.none(), ROYAL_BLUE, noneGetter);
+			plotLegend(data.barLabels.write(), FIRE_BRICK);
+			plotLegend(data.barLabels.read(), GOLDEN_ROD);
+			plotLegend(data.barLabels.full(), FOREST_GREEN);
+			plotLegend(data.barLabels.none(), ROYAL_BLUE);
+			if(sorter.data().getVectorOps() != 0)
+			{
+				plotLegend(data.barLabels.vectorOps, GOLDEN_ROD);
+			}
+			if(sorter.data().getReads() != 0 || sorter.data().getWrites() != 0)
+			{
+				plotLegend(data.barLabels.reads, GOLDEN_ROD);
+				plotLegend(data.barLabels.writes, FIRE_BRICK);
+			}
+			if(sorter.data().getPeakAuxBytes() != 0)
+			{
+				plotLegend(data.barLabels.peakAuxBytes, SLATE_GRAY);
+			}
+			if(sorter.data().getSequentialLaneSteps() != 0)
+			{
+				plotLegend(data.barLabels.sequential, SLATE_GRAY);
+			}
+			for(size_t level = 0; level < data.barLabels.cacheMisses.size(); ++level)
+			{
+				plotLegend(data.barLabels.cacheHits[level], SLATE_GRAY);
+				plotLegend(data.barLabels.cacheMisses[level], SLATE_GRAY);
+			}
+
+			drawBars(sorter, data.barColumns[sorterIdx], pixelColumns, elements);
 
 			ImPlot::EndPlot();
 		}
+		for(size_t aux = 0; aux < auxiliaries.size(); ++aux)
+		{
+			ImGui::PushID(static_cast<int>(aux));
+			if(ImPlot::BeginPlot("##aux", ImVec2(plotSize.x, auxHeight), flags::PLOT | ImPlotFlags_NoLegend))
+			{
+				ImPlot::SetupAxes(nullptr, nullptr, flags::XAXIS, flags::YAXIS);
+
+				const auto auxElements = static_cast<double>(auxiliaries[aux].size());
+				const auto elements = static_cast<double>(sorter.data().size());
+				ImPlot::SetupAxesLimits(-0.5, auxElements - 0.5, 0.0, elements, ImPlotCond_Always);
+
+				drawAux(auxiliaries[aux], pixelColumns, elements);
+
+				ImPlot::EndPlot();
+			}
+			ImGui::PopID();
+		}
+		ImGui::EndGroup();
+		ImGui::PopID();
+		++sorterIdx;
 		if(++sorterLineNumber != data.sortersPerRow)
 		{
 			ImGui::SameLine();
@@ -222,7 +466,6 @@ void sortvis::render(sortvis::GUIData& data)
 			addAboutRow("ImPlot", "[MIT]", "https://github.com/epezent/implot");
 			addAboutRow("SFML", "[ZLIB]", "https://github.com/SFML/SFML");
 			addAboutRow("ImGui-SFML", "[MIT]", "https://github.com/eliasdaler/imgui-sfml");
-			addAboutRow("CppCoro", "[MIT]", "https://github.com/lewissbaker/cppcoro");
 			addAboutRow(nullptr, nullptr, "for testing only:");
 			addAboutRow("Catch2", "[BSL]", "https://github.com/catchorg/Catch2");
 
@@ -0,0 +1,391 @@
+#include "headless.hpp"
+#include "sorter.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+constexpr size_t BATCH_STEPS = 4096;
+
+/**
+ * @return std::vector<std::string_view> the comma separated items of list
+ */
+std::vector<std::string_view> splitList(std::string_view list)
+{
+	std::vector<std::string_view> items;
+	while(true)
+	{
+		const size_t comma = list.find(',');
+		items.push_back(list.substr(0, comma));
+		if(comma == std::string_view::npos)
+		{
+			return items;
+		}
+		list.remove_prefix(comma + 1);
+	}
+}
+
+/**
+ * @throws std::invalid_argument if text is no unsigned number
+ */
+template<typename T>
+T parseNumber(std::string_view text)
+{
+	T value = 0;
+	const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+	if(error != std::errc() || end != text.data() + text.size())
+	{
+		throw std::invalid_argument("expected a number instead of \"" + std::string(text) + '"');
+	}
+	return value;
+}
+
+template<typename T>
+std::vector<T> parseNumbers(std::string_view list)
+{
+	std::vector<T> values;
+	for(std::string_view item : splitList(list))
+	{
+		values.push_back(parseNumber<T>(item));
+	}
+	return values;
+}
+
+/**
+ * @throws std::invalid_argument if name is no Distribution
+ */
+sortvis::Distribution parseDistribution(std::string_view name)
+{
+	const auto* found = std::find_if(sortvis::DISTRIBUTIONS.begin(), sortvis::DISTRIBUTIONS.end(),
+	    [name](sortvis::Distribution distribution)
+	    {
+		    return name == sortvis::getDistributionName(distribution);
+	    });
+	if(found == sortvis::DISTRIBUTIONS.end())
+	{
+		throw std::invalid_argument("unknown input \"" + std::string(name) + '"');
+	}
+	return *found;
+}
+
+/**
+ * @return std::string text as CSV field
+ */
+std::string csvField(std::string_view text)
+{
+	std::string field = "\"";
+	for(char c : text)
+	{
+		field += c == '"' ? "\"\"" : std::string(1, c);
+	}
+	return field + '"';
+}
+
+/**
+ * @return std::string text as JSON string
+ */
+std::string jsonString(std::string_view text)
+{
+	std::string escaped = "\"";
+	for(char c : text)
+	{
+		if(c == '"' || c == '\\')
+		{
+			escaped += '\\';
+			escaped += c;
+		}
+		else if(static_cast<unsigned char>(c) < 0x20)
+		{
+			std::ostringstream code;
+			code << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c);
+			escaped += code.str();
+		}
+		else
+		{
+			escaped += c;
+		}
+	}
+	return escaped + '"';
+}
+
+/**
+ * @return std::vector<sortvis::SorterAlgorithm> registered algorithms named by names, all if names is empty
+ * @throws std::invalid_argument for unknown names
+ */
+std::vector<sortvis::SorterAlgorithm> findAlgorithms(const std::vector<std::string>& names)
+{
+	if(names.empty())
+	{
+		return sortvis::registeredSorterAlgorithms();
+	}
+	std::vector<sortvis::SorterAlgorithm> algorithms;
+	for(const std::string& name : names)
+	{
+		const sortvis::AlgorithmInfo* info = sortvis::findAlgorithm(name);
+		if(info == nullptr)
+		{
+			throw std::invalid_argument("unknown algorithm \"" + name + '"');
+		}
+		algorithms.push_back(info->algorithm);
+	}
+	return algorithms;
+}
+} // namespace
+
+namespace sortvis::headless
+{
+RunWriter::RunWriter(std::ostream& output, sortvis::headless::Format outputFormat) :
+    out{output}, format{outputFormat}
+{
+}
+
+void RunWriter::begin()
+{
+	if(format == sortvis::headless::Format::Csv)
+	{
+		out << "algorithm,input,elements,seed,steps,compares,swaps,reads,writes,vector_ops,peak_aux_bytes,"
+		       "seconds,finished,sorted\n";
+	}
+	else
+	{
+		out << '[';
+	}
+}
+
+void RunWriter::write(const sortvis::headless::Run& run)
+{
+	if(written == 0)
+	{
+		begin();
+	}
+
+	std::ostringstream seconds;
+	seconds << std::setprecision(9) << run.seconds;
+
+	if(format == sortvis::headless::Format::Csv)
+	{
+		out << csvField(run.algorithm) << ',' << csvField(sortvis::getDistributionName(run.input)) << ','
+		    << run.elements << ',' << run.seed << ',' << run.steps << ',' << run.compares << ',' << run.swaps << ','
+		    << run.reads << ',' << run.writes << ',' << run.vectorOps << ',' << run.peakAuxBytes << ','
+		    << seconds.str() << ',' << (run.finished ? "true" : "false") << ',' << (run.sorted ? "true" : "false")
+		    << '\n';
+	}
+	else
+	{
+		out << (written == 0 ? "\n" : ",\n") << "  {\"algorithm\": " << jsonString(run.algorithm)
+		    << ", \"input\": " << jsonString(sortvis::getDistributionName(run.input))
+		    << ", \"elements\": " << run.elements << ", \"seed\": " << run.seed << ", \"steps\": " << run.steps
+		    << ", \"compares\": " << run.compares << ", \"swaps\": " << run.swaps << ", \"reads\": " << run.reads
+		    << ", \"writes\": " << run.writes << ", \"vector_ops\": " << run.vectorOps
+		    << ", \"peak_aux_bytes\": " << run.peakAuxBytes << ", \"seconds\": " << seconds.str()
+		    << ", \"finished\": " << (run.finished ? "true" : "false")
+		    << ", \"sorted\": " << (run.sorted ? "true" : "false") << '}';
+	}
+	++written;
+	out.flush();
+}
+
+void RunWriter::finish()
+{
+	if(written == 0)
+	{
+		begin();
+	}
+	if(format == sortvis::headless::Format::Json)
+	{
+		out << (written == 0 ? "]\n" : "\n]\n");
+	}
+	out.flush();
+}
+
+sortvis::headless::Options parseArguments(std::span<const std::string_view> args)
+{
+	sortvis::headless::Options options;
+	for(size_t i = 0; i < args.size(); ++i)
+	{
+		const std::string_view arg = args[i];
+		if(arg == "--headless")
+		{
+			continue;
+		}
+		if(i + 1 == args.size())
+		{
+			throw std::invalid_argument("unknown argument or missing value \"" + std::string(arg) + '"');
+		}
+		const std::string_view value = args[++i];
+		if(arg == "--algorithms")
+		{
+			options.algorithms.clear();
+			for(std::string_view name : splitList(value))
+			{
+				options.algorithms.emplace_back(name);
+			}
+		}
+		else if(arg == "--sizes")
+		{
+			options.sizes = parseNumbers<size_t>(value);
+		}
+		else if(arg == "--seeds")
+		{
+			options.seeds = parseNumbers<uint64_t>(value);
+		}
+		else if(arg == "--inputs")
+		{
+			options.inputs.clear();
+			for(std::string_view name : splitList(value))
+			{
+				options.inputs.push_back(parseDistribution(name));
+			}
+		}
+		else if(arg == "--format")
+		{
+			if(value != "csv" && value != "json")
+			{
+				throw std::invalid_argument("unknown format \"" + std::string(value) + '"');
+			}
+			options.format = value == "csv" ? sortvis::headless::Format::Csv : sortvis::headless::Format::Json;
+		}
+		else if(arg == "--max-steps")
+		{
+			options.maxSteps = parseNumber<size_t>(value);
+		}
+		else if(arg == "--threads")
+		{
+			options.threads = parseNumber<size_t>(value);
+		}
+		else if(arg == "--plugins")
+		{
+			options.plugins = value;
+		}
+		else
+		{
+			throw std::invalid_argument("unknown argument \"" + std::string(arg) + '"');
+		}
+	}
+	return options;
+}
+
+size_t run(const sortvis::headless::Options& options, sortvis::headless::RunWriter& writer)
+{
+	sortvis::loadPlugins(options.plugins);
+	const std::vector<sortvis::SorterAlgorithm> algorithms = findAlgorithms(options.algorithms);
+
+	size_t failures = 0;
+	for(size_t elements : options.sizes)
+	{
+		for(sortvis::Distribution input : options.inputs)
+		{
+			for(uint64_t seed : options.seeds)
+			{
+				sortvis::SortableCollection initial(elements);
+				initial.generate(input, seed);
+				std::vector<int> expected(initial.values().begin(), initial.values().end());
+				std::sort(expected.begin(), expected.end());
+
+				sortvis::SorterCollection sorters(initial, algorithms);
+				sorters.setThreads(options.threads);
+				sorters.advanceUntil(
+				    []
+				    {
+					    return false;
+				    },
+				    options.maxSteps, BATCH_STEPS);
+
+				for(const sortvis::Sorter& sorter : sorters)
+				{
+					const sortvis::SortableCollection& data = sorter.data();
+					sortvis::headless::Run result{.algorithm = sorter.name(),
+					    .input = input,
+					    .elements = elements,
+					    .seed = seed,
+					    .steps = sorter.step(),
+					    .compares = data.getCounter(sortvis::Sortable::AccessState::Read),
+					    .swaps = data.getCounter(sortvis::Sortable::AccessState::Write),
+					    .reads = data.getReads(),
+					    .writes = data.getWrites(),
+					    .vectorOps = data.getVectorOps(),
+					    .peakAuxBytes = data.getPeakAuxBytes(),
+					    .seconds = std::chrono::duration<double>(sorter.busyTime()).count(),
+					    .finished = sorter.hasFinished(),
+					    .sorted = std::equal(expected.begin(), expected.end(), data.values().begin(),
+					        data.values().end())};
+					failures += static_cast<size_t>(result.finished && !result.sorted);
+					writer.write(result);
+				}
+			}
+		}
+	}
+	writer.finish();
+	return failures;
+}
+
+std::string usage(std::string_view program)
+{
+	std::ostringstream text;
+	text << "usage: " << program
+	     << " --headless [--algorithms NAMES] [--sizes N,...] [--seeds SEED,...] [--inputs NAMES] [--format csv|json]"
+	        " [--max-steps N] [--threads N] [--plugins DIR]\n"
+	        "runs every algorithm (default all) on every size (default 1000), input (default random)"
+	        " & seed (default 1) without a window\n"
+	        "algorithms:";
+	for(const sortvis::AlgorithmInfo& info : sortvis::registeredAlgorithms())
+	{
+		text << " \"" << info.name << '"';
+	}
+	text << "\ninputs:";
+	for(sortvis::Distribution distribution : sortvis::DISTRIBUTIONS)
+	{
+		text << " \"" << sortvis::getDistributionName(distribution) << '"';
+	}
+	return text.str();
+}
+
+int main(std::span<char*> args)
+{
+	const std::string_view program = args.empty() ? "SortVis" : args.front();
+	std::vector<std::string_view> arguments;
+	for(const char* arg : args.subspan(args.empty() ? 0 : 1))
+	{
+		arguments.emplace_back(arg);
+	}
+
+	try
+	{
+		const sortvis::headless::Options options = sortvis::headless::parseArguments(arguments);
+		sortvis::headless::RunWriter writer(std::cout, options.format);
+		if(sortvis::headless::run(options, writer) != 0)
+		{
+			std::cerr << "some algorithms did not sort their input" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	catch(std::invalid_argument& e)
+	{
+		std::cerr << e.what() << '\n' << sortvis::headless::usage(program) << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch(sortvis::InitFailureException& e)
+	{
+		std::cerr << "[InitFailureException] " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch(sortvis::PluginException& e)
+	{
+		std::cerr << "[PluginException] " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	catch(std::exception& e)
+	{
+		std::cerr << "[StdException] " << e.what() << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
+} // namespace sortvis::headless
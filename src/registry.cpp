@@ -0,0 +1,262 @@
+#include "registry.hpp"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace
+{
+constexpr size_t QUADRATIC_MAX = 10'000;
+constexpr size_t LOG_SQUARED_MAX = 1'000'000;
+constexpr size_t LINEARITHMIC_MAX = 10'000'000;
+
+#if defined(_WIN32)
+constexpr const char* PLUGIN_EXTENSION = ".dll";
+#else
+constexpr const char* PLUGIN_EXTENSION = ".so";
+#endif
+
+/**
+ * @brief all registered algorithms, a std::deque keeps handed out pointers valid while it grows
+ *
+ */
+struct Registry
+{
+	std::mutex mutex;
+	std::deque<sortvis::AlgorithmInfo> algorithms;
+
+	Registry()
+	{
+		using sortvis::AuxMemory;
+		namespace algo = sortvis::algorithms;
+		algorithms = {
+		    {"Bubble Sort", algo::bubble, algo::native::bubble, true, AuxMemory::Constant, QUADRATIC_MAX},
+		    {"Quick Sort", algo::quick, algo::native::quick, false, AuxMemory::Logarithmic, QUADRATIC_MAX},
+		    {"Quick Sort (Hoare)", algo::hoareQuick, algo::native::hoareQuick, false, AuxMemory::Logarithmic,
+		        LINEARITHMIC_MAX},
+		    {"Quick Sort (3-Way)", algo::threeWayQuick, algo::native::threeWayQuick, false, AuxMemory::Logarithmic,
+		        LINEARITHMIC_MAX},
+		    {"Quick Sort (Random Pivot)", algo::randomQuick, algo::native::randomQuick, false,
+		        AuxMemory::Logarithmic, LINEARITHMIC_MAX},
+		    {"Shell Sort", algo::shell, algo::native::shell, false, AuxMemory::Constant, LOG_SQUARED_MAX},
+		    {"Shell Sort (Tokuda)", algo::tokudaShell, algo::native::tokudaShell, false, AuxMemory::Constant,
+		        LOG_SQUARED_MAX},
+		    {"Shell Sort (Sedgewick)", algo::sedgewickShell, algo::native::sedgewickShell, false, AuxMemory::Constant,
+		        LOG_SQUARED_MAX},
+		    {"Heap Sort", algo::heap, algo::native::heap, false, AuxMemory::Constant, LINEARITHMIC_MAX},
+		    {"Insertion Sort", algo::insertion, algo::native::insertion, true, AuxMemory::Constant, QUADRATIC_MAX},
+		    {"Selection Sort", algo::selection, algo::native::selection, false, AuxMemory::Constant, QUADRATIC_MAX},
+		    {"Bitonic Block Sort", algo::bitonic, algo::native::bitonic, false, AuxMemory::Linear, LOG_SQUARED_MAX},
+		    {"LSD Radix Sort", algo::lsdRadix, algo::native::lsdRadix, true, AuxMemory::Linear, LINEARITHMIC_MAX},
+		    {"MSD Radix Sort", algo::msdRadix, algo::native::msdRadix, true, AuxMemory::Linear, LINEARITHMIC_MAX},
+		    {"Top-Down Merge Sort", algo::topDownMerge, algo::native::topDownMerge, true, AuxMemory::Linear,
+		        LINEARITHMIC_MAX},
+		    {"Bottom-Up Merge Sort", algo::bottomUpMerge, algo::native::bottomUpMerge, true, AuxMemory::Linear,
+		        LINEARITHMIC_MAX},
+		    {"Natural Merge Sort", algo::naturalMerge, algo::native::naturalMerge, true, AuxMemory::Linear,
+		        LINEARITHMIC_MAX},
+		    {"Intro Sort", algo::intro, algo::native::intro, false, AuxMemory::Logarithmic, LINEARITHMIC_MAX},
+		    {"Pattern Defeating Quick Sort", algo::pdq, algo::native::pdq, false, AuxMemory::Logarithmic,
+		        LINEARITHMIC_MAX},
+		    {"Tim Sort", algo::tim, algo::native::tim, true, AuxMemory::Linear, LINEARITHMIC_MAX},
+		    {"Parallel Merge Sort", algo::parallelMerge, nullptr, true, AuxMemory::Logarithmic, LOG_SQUARED_MAX},
+		    {"Parallel Sample Sort", algo::parallelSample, nullptr, false, AuxMemory::Logarithmic,
+		        LINEARITHMIC_MAX}};
+	}
+
+	/**
+	 * @return const sortvis::AlgorithmInfo* first algorithm matching pred or nullptr, mutex has to be held
+	 */
+	template<typename PRED>
+	[[nodiscard]] const sortvis::AlgorithmInfo* find(PRED pred) const
+	{
+		const auto found = std::find_if(algorithms.begin(), algorithms.end(), pred);
+		return found == algorithms.end() ? nullptr : &*found;
+	}
+};
+
+Registry& registry()
+{
+	static Registry instance;
+	return instance;
+}
+
+/**
+ * @brief loads library & looks up its entry point, the library is never unloaded
+ *
+ */
+sortvis::PluginEntry openPlugin(const std::filesystem::path& library)
+{
+#if defined(_WIN32)
+	HMODULE handle = LoadLibraryW(library.c_str());
+	if(handle == nullptr)
+	{
+		throw sortvis::PluginException(library.string() + ": LoadLibrary failed with error " +
+		                               std::to_string(GetLastError()));
+	}
+	FARPROC entry = GetProcAddress(handle, sortvis::PLUGIN_ENTRY_NAME);
+#else
+	void* handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+	if(handle == nullptr)
+	{
+		throw sortvis::PluginException(dlerror()); // names the library itself
+	}
+	void* entry = dlsym(handle, sortvis::PLUGIN_ENTRY_NAME);
+#endif
+	if(entry == nullptr)
+	{
+		throw sortvis::PluginException(library.string() + ": no entry point " + sortvis::PLUGIN_ENTRY_NAME);
+	}
+	return reinterpret_cast<sortvis::PluginEntry>(entry);
+}
+} // namespace
+
+namespace sortvis
+{
+void registerAlgorithm(const sortvis::AlgorithmInfo& info)
+{
+	Registry& reg = registry();
+	std::lock_guard lock(reg.mutex);
+	const std::string_view name(info.name);
+	if(info.algorithm == nullptr || reg.find(
+	                                    [&info, name](const sortvis::AlgorithmInfo& other)
+	                                    {
+		                                    return other.algorithm == info.algorithm || other.name == name;
+	                                    }) != nullptr)
+	{
+		throw sortvis::PluginException(std::string(name) + " is null or already registered");
+	}
+	reg.algorithms.push_back(info);
+}
+
+std::vector<sortvis::AlgorithmInfo> registeredAlgorithms()
+{
+	Registry& reg = registry();
+	std::lock_guard lock(reg.mutex);
+	return {reg.algorithms.begin(), reg.algorithms.end()};
+}
+
+std::vector<sortvis::SorterAlgorithm> registeredSorterAlgorithms()
+{
+	Registry& reg = registry();
+	std::lock_guard lock(reg.mutex);
+	std::vector<sortvis::SorterAlgorithm> algorithms;
+	for(const sortvis::AlgorithmInfo& info : reg.algorithms)
+	{
+		algorithms.push_back(info.algorithm);
+	}
+	return algorithms;
+}
+
+const sortvis::AlgorithmInfo* findAlgorithm(sortvis::SorterAlgorithm algorithm)
+{
+	Registry& reg = registry();
+	std::lock_guard lock(reg.mutex);
+	return reg.find(
+	    [algorithm](const sortvis::AlgorithmInfo& info)
+	    {
+		    return info.algorithm == algorithm;
+	    });
+}
+
+const sortvis::AlgorithmInfo* findAlgorithm(std::string_view name)
+{
+	Registry& reg = registry();
+	std::lock_guard lock(reg.mutex);
+	return reg.find(
+	    [name](const sortvis::AlgorithmInfo& info)
+	    {
+		    return info.name == name;
+	    });
+}
+
+size_t loadPlugin(const std::filesystem::path& library)
+{
+	const sortvis::PluginEntry entry = openPlugin(library);
+	const sortvis::PluginManifest* manifest = entry();
+	if(manifest == nullptr || manifest->apiVersion != sortvis::PLUGIN_API_VERSION ||
+	    manifest->collectionSize != sizeof(sortvis::SortableCollection))
+	{
+		throw sortvis::PluginException(library.string() + ": built for a different version of SortVis");
+	}
+	for(size_t i = 0; i < manifest->count; ++i)
+	{
+		sortvis::registerAlgorithm(manifest->algorithms[i]);
+	}
+	return manifest->count;
+}
+
+size_t loadPlugins(const std::filesystem::path& directory)
+{
+	std::error_code error;
+	if(!std::filesystem::is_directory(directory, error))
+	{
+		return 0;
+	}
+
+	size_t loaded = 0;
+	std::string failures;
+	for(const std::filesystem::directory_entry& file : std::filesystem::directory_iterator(directory))
+	{
+		if(!file.is_regular_file() || file.path().extension() != PLUGIN_EXTENSION)
+		{
+			continue;
+		}
+		try
+		{
+			loaded += loadPlugin(file.path());
+		}
+		catch(const sortvis::PluginException& e)
+		{
+			failures += failures.empty() ? e.what() : std::string("; ") + e.what();
+		}
+	}
+	if(!failures.empty())
+	{
+		throw sortvis::PluginException(failures);
+	}
+	return loaded;
+}
+
+const char* getAuxMemoryName(sortvis::AuxMemory aux) noexcept
+{
+	switch(aux)
+	{
+	case sortvis::AuxMemory::Constant:
+		return "O(1)";
+	case sortvis::AuxMemory::Logarithmic:
+		return "O(log n)";
+	case sortvis::AuxMemory::Linear:
+		return "O(n)";
+	}
+	return "UNKNOWN";
+}
+
+/**
+ * @param algorithm function pointer to algo
+ * @return const char* to name of algo
+ */
+const char* getAlgorithmName(SorterAlgorithm algorithm)
+{
+	const sortvis::AlgorithmInfo* info = sortvis::findAlgorithm(algorithm);
+	return info == nullptr ? "UNKNOWN" : info->name;
+}
+
+/**
+ * @param algorithm function pointer to algo
+ * @return NativeAlgorithm built from the same source or nullptr if unknown
+ */
+NativeAlgorithm getNativeAlgorithm(SorterAlgorithm algorithm)
+{
+	const sortvis::AlgorithmInfo* info = sortvis::findAlgorithm(algorithm);
+	return info == nullptr ? nullptr : info->native;
+}
+} // namespace sortvis
@@ -0,0 +1,287 @@
+#include "simd.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SORTVIS_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC & Clang only emit AVX2 instructions in functions marked for it, MSVC always allows the intrinsics
+#if defined(SORTVIS_SIMD_X86) && defined(__GNUC__)
+#define SORTVIS_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SORTVIS_TARGET_AVX2
+#endif
+
+namespace sortvis::simd
+{
+namespace
+{
+/**
+ * @brief pads a shorter last block, sorts it with sortBlock & copies it back
+ *
+ */
+template<typename SORT_BLOCK>
+void sortBlocksWith(std::span<int> data, SORT_BLOCK sortBlock) noexcept
+{
+	size_t block = 0;
+	for(; block + BLOCK <= data.size(); block += BLOCK)
+	{
+		sortBlock(data.data() + block);
+	}
+	if(block < data.size())
+	{
+		std::array<int, BLOCK> padded{};
+		padded.fill(std::numeric_limits<int>::max());
+		std::copy(data.begin() + static_cast<std::ptrdiff_t>(block), data.end(), padded.begin());
+		sortBlock(padded.data());
+		std::copy_n(padded.begin(), data.size() - block, data.begin() + static_cast<std::ptrdiff_t>(block));
+	}
+}
+
+#if defined(SORTVIS_SIMD_X86)
+/**
+ * @return true if cpuid reports AVX2 and the os saves the ymm registers
+ */
+bool detectAVX2() noexcept
+{
+#if defined(_MSC_VER)
+	constexpr int OSXSAVE = 1 << 27;
+	constexpr int AVX = 1 << 28;
+	constexpr int AVX2 = 1 << 5;
+	constexpr unsigned long long YMM_STATE = 0b110;
+
+	std::array<int, 4> info{};
+	__cpuid(info.data(), 0);
+	if(info[0] < 7)
+	{
+		return false;
+	}
+	__cpuid(info.data(), 1);
+	if((info[2] & OSXSAVE) == 0 || (info[2] & AVX) == 0 || (_xgetbv(0) & YMM_STATE) != YMM_STATE)
+	{
+		return false;
+	}
+	__cpuidex(info.data(), 7, 0);
+	return (info[1] & AVX2) != 0;
+#else
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+/**
+ * @return int blend mask of the lanes holding the larger value of a pair of lanes l & l ^ partnerMask
+ */
+constexpr int upperLanes(int partnerMask) noexcept
+{
+	const int high = partnerMask >= 4 ? 4 : (partnerMask >= 2 ? 2 : 1);
+	int mask = 0;
+	for(int lane = 0; lane < static_cast<int>(WIDTH); ++lane)
+	{
+		mask |= (lane & high) != 0 ? 1 << lane : 0;
+	}
+	return mask;
+}
+
+SORTVIS_TARGET_AVX2 inline __m256i load(const int* first) noexcept
+{
+	return _mm256_loadu_si256(static_cast<const __m256i*>(static_cast<const void*>(first)));
+}
+
+SORTVIS_TARGET_AVX2 inline void store(int* first, __m256i v) noexcept
+{
+	_mm256_storeu_si256(static_cast<__m256i*>(static_cast<void*>(first)), v);
+}
+
+SORTVIS_TARGET_AVX2 inline __m256i reverse(__m256i v) noexcept
+{
+	return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+/**
+ * @brief compare-exchange of the lanes l & l ^ MASK inside v,
+ * the smaller value goes to the lane without the highest bit of MASK
+ *
+ */
+template<int MASK>
+SORTVIS_TARGET_AVX2 inline __m256i exchangeInside(__m256i v) noexcept
+{
+	const __m256i partner = _mm256_permutevar8x32_epi32(
+	    v, _mm256_setr_epi32(0 ^ MASK, 1 ^ MASK, 2 ^ MASK, 3 ^ MASK, 4 ^ MASK, 5 ^ MASK, 6 ^ MASK, 7 ^ MASK));
+	constexpr int UPPER = upperLanes(MASK);
+	return _mm256_blend_epi32(_mm256_min_epi32(v, partner), _mm256_max_epi32(v, partner), UPPER);
+}
+
+/**
+ * @brief sorts a bitonic register
+ *
+ */
+SORTVIS_TARGET_AVX2 inline __m256i cleanInside(__m256i v) noexcept
+{
+	return exchangeInside<1>(exchangeInside<2>(exchangeInside<4>(v)));
+}
+
+/**
+ * @brief the first step of merging two sorted runs, lane l of lo is ordered with lane WIDTH - 1 - l of hi
+ *
+ */
+SORTVIS_TARGET_AVX2 inline void flip(__m256i& lo, __m256i& hi) noexcept
+{
+	const __m256i reversed = reverse(hi);
+	hi = reverse(_mm256_max_epi32(lo, reversed));
+	lo = _mm256_min_epi32(lo, reversed);
+}
+
+/**
+ * @brief sorts BLOCK ints at first with the same bitonic network as the instrumented algorithm,
+ * runs of up to WIDTH are merged inside the registers and longer runs across them
+ *
+ */
+SORTVIS_TARGET_AVX2 void sortBlock(int* first) noexcept
+{
+	__m256i v[WIDTH]; // a std::array would drop the alignment attribute of __m256i
+	for(size_t r = 0; r < WIDTH; ++r)
+	{
+		v[r] = load(first + r * WIDTH);
+	}
+
+	for(__m256i& r : v)
+	{
+		r = exchangeInside<1>(r);
+		r = exchangeInside<1>(exchangeInside<3>(r));
+		r = exchangeInside<1>(exchangeInside<2>(exchangeInside<7>(r)));
+	}
+
+	for(size_t run = 2; run <= WIDTH; run *= 2)
+	{
+		for(size_t base = 0; base < WIDTH; base += run)
+		{
+			for(size_t r = 0; r < run / 2; ++r)
+			{
+				flip(v[base + r], v[base + run - 1 - r]);
+			}
+		}
+		for(size_t half = run / 4; half > 0; half /= 2)
+		{
+			for(size_t r = 0; r < WIDTH; ++r)
+			{
+				if((r & half) == 0)
+				{
+					const __m256i lo = _mm256_min_epi32(v[r], v[r + half]);
+					v[r + half] = _mm256_max_epi32(v[r], v[r + half]);
+					v[r] = lo;
+				}
+			}
+		}
+		for(__m256i& r : v)
+		{
+			r = cleanInside(r);
+		}
+	}
+
+	for(size_t r = 0; r < WIDTH; ++r)
+	{
+		store(first + r * WIDTH, v[r]);
+	}
+}
+
+/**
+ * @brief merges two sorted registers, lo receives the WIDTH smallest values
+ *
+ */
+SORTVIS_TARGET_AVX2 inline void mergeRegisters(__m256i& lo, __m256i& hi) noexcept
+{
+	flip(lo, hi);
+	lo = cleanInside(lo);
+	hi = cleanInside(hi);
+}
+
+SORTVIS_TARGET_AVX2 void mergeAVX2(std::span<const int> lhs, std::span<const int> rhs, int* out) noexcept
+{
+	if(lhs.size() < WIDTH || rhs.size() < WIDTH)
+	{
+		std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), out);
+		return;
+	}
+
+	__m256i lo = load(lhs.data());
+	__m256i hi = load(rhs.data());
+	size_t l = WIDTH;
+	size_t r = WIDTH;
+	mergeRegisters(lo, hi);
+	store(out, lo);
+	out += WIDTH;
+
+	// hi holds the largest values merged so far, the next register comes from the range with the smaller head
+	while(l + WIDTH <= lhs.size() && r + WIDTH <= rhs.size())
+	{
+		if(lhs[l] < rhs[r])
+		{
+			lo = load(lhs.data() + l);
+			l += WIDTH;
+		}
+		else
+		{
+			lo = load(rhs.data() + r);
+			r += WIDTH;
+		}
+		mergeRegisters(lo, hi);
+		store(out, lo);
+		out += WIDTH;
+	}
+
+	// at most one rest holds WIDTH or more values, merge hi with the other one first
+	std::array<int, WIDTH> carry{};
+	store(carry.data(), hi);
+	std::span<const int> shortRest = lhs.subspan(l);
+	std::span<const int> longRest = rhs.subspan(r);
+	if(shortRest.size() >= WIDTH)
+	{
+		std::swap(shortRest, longRest);
+	}
+	std::array<int, 2 * WIDTH> tail{};
+	const auto tailEnd = std::merge(carry.begin(), carry.end(), shortRest.begin(), shortRest.end(), tail.begin());
+	std::merge(tail.begin(), tailEnd, longRest.begin(), longRest.end(), out);
+}
+#endif
+} // namespace
+
+bool supported() noexcept
+{
+#if defined(SORTVIS_SIMD_X86)
+	static const bool avx2 = detectAVX2();
+	return avx2;
+#else
+	return false;
+#endif
+}
+
+void sortBlocks(std::span<int> data) noexcept
+{
+#if defined(SORTVIS_SIMD_X86)
+	sortBlocksWith(data, sortBlock);
+#else
+	sortBlocksWith(data,
+	    [](int* first)
+	    {
+		    std::sort(first, first + BLOCK);
+	    });
+#endif
+}
+
+void merge(std::span<const int> lhs, std::span<const int> rhs, int* out) noexcept
+{
+#if defined(SORTVIS_SIMD_X86)
+	mergeAVX2(lhs, rhs, out);
+#else
+	std::merge(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), out);
+#endif
+}
+} // namespace sortvis::simd
@@ -0,0 +1,111 @@
+#include "sorter.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace
+{
+using Replacement = sortvis::CacheLevel::Replacement;
+constexpr size_t LINE = 16; //! 4 ints per line
+} // namespace
+
+TEST_CASE("CacheLevel::access")
+{
+	SECTION("LRU")
+	{
+		sortvis::CacheLevel level({"L1", 2 * LINE, 2, Replacement::LRU}, LINE);
+
+		CHECK_FALSE(level.access(0));
+		CHECK_FALSE(level.access(1));
+		CHECK(level.access(0));
+		CHECK_FALSE(level.access(2)); // evicts 1
+		CHECK(level.access(0));
+		CHECK_FALSE(level.access(1));
+
+		CHECK(level.hits() == 2);
+		CHECK(level.misses() == 4);
+	}
+
+	SECTION("FIFO")
+	{
+		sortvis::CacheLevel level({"L1", 2 * LINE, 2, Replacement::FIFO}, LINE);
+
+		CHECK_FALSE(level.access(0));
+		CHECK_FALSE(level.access(1));
+		CHECK(level.access(0));
+		CHECK_FALSE(level.access(2)); // evicts 0
+		CHECK(level.access(1));
+		CHECK_FALSE(level.access(0));
+	}
+
+	SECTION("direct mapped")
+	{
+		sortvis::CacheLevel level({"L1", 4 * LINE, 1, Replacement::LRU}, LINE);
+
+		CHECK_FALSE(level.access(1));
+		CHECK_FALSE(level.access(2));
+		CHECK_FALSE(level.access(5)); // same set as 1
+		CHECK(level.access(2));
+		CHECK_FALSE(level.access(1));
+
+		level.reset();
+
+		CHECK(level.hits() == 0);
+		CHECK(level.misses() == 0);
+		CHECK_FALSE(level.access(2));
+	}
+}
+
+TEST_CASE("CacheSimulator::access")
+{
+	sortvis::CacheSimulator cache(
+	    LINE, {{"L1", LINE, 1, Replacement::LRU}, {"L2", 4 * LINE, 4, Replacement::Random}});
+
+	cache.access(0);
+	cache.access(3);
+	cache.access(4);
+	cache.access(0);
+
+	REQUIRE(cache.levels().size() == 2);
+	CHECK(cache.levels()[0].hits() == 1);
+	CHECK(cache.levels()[0].misses() == 3);
+	CHECK(cache.levels()[1].hits() == 1);
+	CHECK(cache.levels()[1].misses() == 2);
+
+	cache.reset();
+
+	CHECK(cache.levels()[0].misses() == 0);
+	CHECK(cache.levels()[1].misses() == 0);
+}
+
+TEST_CASE("Sorter::simulateCache")
+{
+	sortvis::SortableCollection sortables(64);
+	sortables.randomize(1234);
+	sortvis::Sorter sorter(sortables, sortvis::algorithms::bubble);
+
+	CHECK(sorter.cacheSimulator() == nullptr);
+
+	sorter.simulateCache(std::make_unique<sortvis::CacheSimulator>(
+	    LINE, std::initializer_list<sortvis::CacheLevel::Config>{{"L1", 1024, 4, Replacement::LRU}}));
+	sorter.advanceUntil(
+	    [](const sortvis::Sorter&)
+	    {
+		    return false;
+	    });
+
+	const sortvis::CacheLevel& level = sorter.cacheSimulator()->levels()[0];
+	const uint64_t accesses = 2 * (sorter.data().getCounter(sortvis::Sortable::AccessState::Read) +
+	                                  sorter.data().getCounter(sortvis::Sortable::AccessState::Write));
+
+	CHECK(level.hits() + level.misses() == accesses);
+	CHECK(level.misses() == 64 * sizeof(int) / LINE); // everything fits, only cold misses
+
+	sorter.reset(sortables);
+
+	CHECK(sorter.cacheSimulator()->levels()[0].misses() == 0);
+
+	sorter.simulateCache(nullptr);
+	sorter.advance();
+
+	CHECK(sorter.cacheSimulator() == nullptr);
+}
@@ -0,0 +1,89 @@
+#include "cow-plane.hpp"
+#include "sortable.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <numeric>
+#include <vector>
+
+TEST_CASE("CowPlane::writable")
+{
+	constexpr size_t CHUNK_SIZE = sortvis::CowPlane<int>::CHUNK_SIZE;
+	std::vector<int> values(3 * CHUNK_SIZE + 5);
+	std::iota(values.begin(), values.end(), 0);
+
+	sortvis::CowPlane<int> original(values);
+
+	REQUIRE(original.size() == values.size());
+	CHECK(original.ownedChunks() == 4);
+	CHECK(std::equal(original.begin(), original.end(), values.begin(), values.end()));
+
+	sortvis::CowPlane<int> copy(original);
+
+	CHECK(original.ownedChunks() == 0);
+	CHECK(copy.ownedChunks() == 0);
+	CHECK(copy == original);
+
+	copy.writable(CHUNK_SIZE + 1) = -1;
+
+	CHECK(copy.ownedChunks() == 1);
+	CHECK(copy[CHUNK_SIZE + 1] == -1);
+	CHECK(original[CHUNK_SIZE + 1] == static_cast<int>(CHUNK_SIZE + 1));
+	CHECK(copy != original);
+
+	original.writable(CHUNK_SIZE + 1) = -1;
+
+	CHECK(copy == original);
+
+	copy.detach(0, values.size());
+
+	CHECK(copy.ownedChunks() == 4);
+	CHECK(copy == original);
+
+	original = copy;
+	original.writable(values.size() - 1) = 7;
+
+	CHECK(copy[values.size() - 1] == static_cast<int>(values.size() - 1));
+	CHECK(original[values.size() - 1] == 7);
+}
+
+TEST_CASE("CowPlane::assign")
+{
+	sortvis::CowPlane<char> plane(10'000, 'a');
+
+	CHECK(plane.size() == 10'000);
+	CHECK(plane.ownedChunks() == 0);
+	CHECK(std::all_of(plane.begin(), plane.end(),
+	    [](char c)
+	    {
+		    return c == 'a';
+	    }));
+
+	plane.writable(0) = 'b';
+
+	CHECK(plane[0] == 'b');
+	CHECK(plane[sortvis::CowPlane<char>::CHUNK_SIZE] == 'a');
+
+	plane.assign(3, 'c');
+
+	CHECK(plane.size() == 3);
+	CHECK(plane[0] == 'c');
+	CHECK(plane.end() - plane.begin() == 3);
+}
+
+TEST_CASE("CowPlane writers may throw")
+{
+	sortvis::CowPlane<int> plane(4, 0);
+	sortvis::SortableCollection sortables{{2, 1}};
+	const std::array<size_t, 1> lhs{0};
+	const std::array<size_t, 1> rhs{1};
+
+	// writes copy a chunk shared with another plane, bad_alloc has to reach the caller instead of terminating
+	CHECK_FALSE(noexcept(plane.writable(0)));
+	CHECK_FALSE(noexcept(plane.detach(0, 1)));
+	CHECK_FALSE(noexcept(sortables.swap(0, 1)));
+	CHECK_FALSE(noexcept(sortables.less(0, 1)));
+	CHECK_FALSE(noexcept(sortables.write(0, 1)));
+	CHECK_FALSE(noexcept(sortables.compareExchange(lhs, rhs)));
+}
@@ -0,0 +1,89 @@
+#include "dirty-ranges.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+namespace
+{
+std::vector<std::pair<size_t, size_t>> toPairs(const sortvis::DirtyRanges& dirty)
+{
+	std::vector<std::pair<size_t, size_t>> pairs;
+	for(const sortvis::DirtyRanges::Range& range : dirty.get())
+	{
+		pairs.emplace_back(range.first, range.last);
+	}
+	return pairs;
+}
+} // namespace
+
+TEST_CASE("DirtyRanges::mark")
+{
+	sortvis::DirtyRanges dirty;
+
+	CHECK(dirty.all());
+
+	dirty.mark(3);
+
+	CHECK(dirty.all());
+
+	dirty.clear();
+
+	CHECK(dirty.empty());
+
+	dirty.mark(10);
+	dirty.mark(2);
+	dirty.mark(20, 25);
+
+	CHECK(toPairs(dirty) == std::vector<std::pair<size_t, size_t>>{{2, 3}, {10, 11}, {20, 25}});
+
+	dirty.mark(3);
+	dirty.mark(9, 20);
+
+	CHECK(toPairs(dirty) == std::vector<std::pair<size_t, size_t>>{{2, 4}, {9, 25}});
+
+	dirty.mark(0, 100);
+
+	CHECK(toPairs(dirty) == std::vector<std::pair<size_t, size_t>>{{0, 100}});
+}
+
+TEST_CASE("DirtyRanges::MAX_RANGES")
+{
+	sortvis::DirtyRanges dirty;
+	dirty.clear();
+
+	for(size_t i = 0; i < sortvis::DirtyRanges::MAX_RANGES; ++i)
+	{
+		dirty.mark(i * 10);
+	}
+	dirty.mark(1000);
+
+	REQUIRE(dirty.get().size() == sortvis::DirtyRanges::MAX_RANGES);
+	CHECK(dirty.get().front().first == 0);
+	CHECK(dirty.get().back().last == 1001);
+
+	dirty.mark(155);
+
+	REQUIRE(dirty.get().size() == sortvis::DirtyRanges::MAX_RANGES);
+	for(size_t i = 0; i < sortvis::DirtyRanges::MAX_RANGES; ++i)
+	{
+		CHECK(dirty.get()[i].first < dirty.get()[i].last);
+	}
+}
+
+TEST_CASE("DirtyRanges::operator=")
+{
+	sortvis::DirtyRanges dirty;
+	dirty.clear();
+	dirty.mark(4);
+
+	sortvis::DirtyRanges copy(dirty);
+
+	CHECK(copy.all());
+
+	copy.clear();
+	copy = dirty;
+
+	CHECK(copy.all());
+	CHECK_FALSE(dirty.all());
+}
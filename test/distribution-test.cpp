@@ -0,0 +1,130 @@
+#include "distribution.hpp"
+#include "thread-pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include <vector>
+
+TEST_CASE("CounterRng")
+{
+	// known answers of Philox4x32-10 from the Random123 distribution
+	CHECK(sortvis::CounterRng(0).block(0) == std::array<uint32_t, 4>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+	CHECK(sortvis::CounterRng(UINT64_MAX).block(UINT64_MAX, UINT64_MAX) ==
+	      std::array<uint32_t, 4>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+
+	const sortvis::CounterRng rng(42);
+	CHECK(rng(7, 1) == sortvis::CounterRng(42)(7, 1));
+	CHECK(rng(7, 1) != rng(7, 2));
+	CHECK(rng(7, 1) != rng(8, 1));
+
+	for(uint64_t counter = 0; counter < 1000; ++counter)
+	{
+		REQUIRE(rng.below(10, counter) < 10);
+		const double unit = rng.unit(counter);
+		REQUIRE(unit >= 0.0);
+		REQUIRE(unit < 1.0);
+	}
+}
+
+TEST_CASE("generate(Random)")
+{
+	constexpr size_t ELEMENTS = 200'000; // several chunks to shuffle in parallel
+	std::vector<int> sequential(ELEMENTS);
+	std::vector<int> parallel(ELEMENTS);
+	sortvis::ThreadPool pool(4);
+
+	sortvis::generate(sequential, sortvis::Distribution::Random, 4711);
+	sortvis::generate(parallel, sortvis::Distribution::Random, 4711, {}, &pool);
+
+	CHECK(sequential == parallel);
+	CHECK_FALSE(std::is_sorted(sequential.begin(), sequential.end()));
+
+	std::sort(sequential.begin(), sequential.end());
+	std::vector<int> expected(ELEMENTS);
+	std::iota(expected.begin(), expected.end(), 1);
+	CHECK(sequential == expected);
+
+	sortvis::generate(sequential, sortvis::Distribution::Random, 4712);
+	CHECK(sequential != parallel);
+
+	// every value lands in each half about equally often
+	std::vector<int> small(64);
+	size_t firstHalf = 0;
+	for(uint64_t seed = 0; seed < 1000; ++seed)
+	{
+		sortvis::generate(small, sortvis::Distribution::Random, seed);
+		firstHalf += static_cast<size_t>(std::find(small.begin(), small.end(), 1) < small.begin() + 32);
+	}
+	CHECK(firstHalf > 400);
+	CHECK(firstHalf < 600);
+}
+
+TEST_CASE("generate")
+{
+	constexpr size_t ELEMENTS = 10'000;
+	std::vector<int> values(ELEMENTS);
+
+	for(sortvis::Distribution distribution : sortvis::DISTRIBUTIONS)
+	{
+		sortvis::generate(values, distribution, 99);
+		CHECK(*std::min_element(values.begin(), values.end()) >= 1);
+		CHECK(*std::max_element(values.begin(), values.end()) <= static_cast<int>(ELEMENTS));
+	}
+
+	sortvis::generate(values, sortvis::Distribution::Sorted, 99);
+	CHECK(std::is_sorted(values.begin(), values.end()));
+
+	sortvis::generate(values, sortvis::Distribution::Reversed, 99);
+	CHECK(std::is_sorted(values.rbegin(), values.rend()));
+	CHECK(values.front() == static_cast<int>(ELEMENTS));
+
+	sortvis::generate(values, sortvis::Distribution::NearlySorted, 99, {.swaps = 10});
+	size_t displaced = 0;
+	for(size_t i = 0; i < ELEMENTS; ++i)
+	{
+		displaced += static_cast<size_t>(values[i] != static_cast<int>(i + 1));
+	}
+	CHECK(displaced > 0);
+	CHECK(displaced <= 20);
+
+	sortvis::generate(values, sortvis::Distribution::Sawtooth, 99, {.period = 100});
+	CHECK(std::is_sorted(values.begin(), values.begin() + 100));
+	CHECK(values[99] > values[100]);
+
+	sortvis::generate(values, sortvis::Distribution::FewUnique, 99, {.unique = 5});
+	CHECK(std::set<int>(values.begin(), values.end()).size() == 5);
+
+	sortvis::generate(values, sortvis::Distribution::OrganPipe, 99);
+	const auto peak = std::max_element(values.begin(), values.end());
+	CHECK(std::is_sorted(values.begin(), peak));
+	CHECK(std::is_sorted(values.rbegin(), std::make_reverse_iterator(peak)));
+	std::vector<int> sorted(values);
+	std::sort(sorted.begin(), sorted.end());
+	CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+
+	sortvis::generate(values, sortvis::Distribution::Runs, 99, {.period = 100});
+	for(size_t run = 0; run < ELEMENTS; run += 100)
+	{
+		REQUIRE(std::is_sorted(values.begin() + static_cast<std::ptrdiff_t>(run),
+		    values.begin() + static_cast<std::ptrdiff_t>(run + 100)));
+	}
+	CHECK_FALSE(std::is_sorted(values.begin(), values.end()));
+
+	sortvis::generate(values, sortvis::Distribution::Zipf, 99);
+	const auto ones = std::count(values.begin(), values.end(), 1);
+	const auto twos = std::count(values.begin(), values.end(), 2);
+	const auto threes = std::count(values.begin(), values.end(), 3);
+	CHECK(ones > twos);
+	CHECK(twos > threes);
+	// 1 / H(10000) of all values are ones
+	CHECK(ones > 900);
+	CHECK(ones < 1200);
+}
+
+TEST_CASE("freshSeed")
+{
+	CHECK(sortvis::freshSeed() != sortvis::freshSeed());
+}
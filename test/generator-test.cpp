@@ -0,0 +1,112 @@
+#include "algorithms.hpp"
+#include "generator.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+
+namespace
+{
+sortvis::Generator<const int> CountGen(int count)
+{
+	for(int i = 0; i < count; ++i)
+	{
+		co_yield i;
+	}
+}
+
+sortvis::Generator<const int> ThrowGen()
+{
+	co_yield 1;
+	throw std::runtime_error("generator failed");
+}
+
+size_t runHeap(sortvis::FrameArena& arena)
+{
+	sortvis::SortableCollection sortables(64);
+	sortables.randomize(42);
+	sortvis::FrameArena::Scope scope(arena);
+	sortvis::Generator<const int> gen =
+	    sortvis::algorithms::heap(std::make_shared<sortvis::SortableCollection>(sortables));
+	size_t steps = 0;
+	for([[maybe_unused]] const int value : gen)
+	{
+		++steps;
+	}
+	return steps;
+}
+} // namespace
+
+TEST_CASE("Generator::begin")
+{
+	std::vector<int> values;
+	for(const int value : CountGen(4))
+	{
+		values.push_back(value);
+	}
+	CHECK(values == std::vector<int>{0, 1, 2, 3});
+
+	sortvis::Generator<const int> empty = CountGen(0);
+	CHECK(empty.begin() == empty.end());
+
+	sortvis::Generator<const int> throwing = ThrowGen();
+	auto it = throwing.begin();
+	CHECK(*it == 1);
+	CHECK_THROWS_AS(++it, std::runtime_error);
+}
+
+TEST_CASE("FrameArena::allocate")
+{
+	sortvis::FrameArena arena;
+
+	const size_t steps = runHeap(arena);
+	const size_t allocations = arena.allocations();
+
+	CHECK(steps > 0);
+	CHECK(allocations > 0);
+
+	for(int run = 0; run < 3; ++run)
+	{
+		CHECK(runHeap(arena) == steps);
+	}
+	CHECK(arena.allocations() == allocations);
+
+	{
+		sortvis::Generator<const int> outside = CountGen(1);
+		CHECK(*outside.begin() == 0);
+	}
+	CHECK(arena.allocations() == allocations);
+}
+
+TEST_CASE("Generator::yield_value")
+{
+	auto nested = []() -> sortvis::Generator<const int>
+	{
+		co_yield -1;
+		co_yield CountGen(2);
+		co_yield CountGen(0);
+		sortvis::Generator<const int> inner = CountGen(3);
+		co_yield inner;
+		co_yield -2;
+	};
+
+	std::vector<int> values;
+	for(const int value : nested())
+	{
+		values.push_back(value);
+	}
+	CHECK(values == std::vector<int>{-1, 0, 1, 0, 1, 2, -2});
+
+	auto throwing = []() -> sortvis::Generator<const int>
+	{
+		co_yield CountGen(1);
+		co_yield ThrowGen();
+		co_yield -1;
+	};
+
+	sortvis::Generator<const int> gen = throwing();
+	auto it = gen.begin();
+	CHECK(*it == 0);
+	CHECK(*++it == 1);
+	CHECK_THROWS_AS(++it, std::runtime_error);
+}
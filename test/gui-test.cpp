@@ -15,12 +15,13 @@ TEST_CASE("NumberedString")
 	CHECK(numstr.data() == std::string("STATIC: 64"));
 }
 
-cppcoro::generator<const int> BarGen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> BarGen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 	data->less(2, 3);
 	data->swap(4, 5);
 	data->state(sortvis::Sortable::SortState::Full, 0U, 1U);
+	data->sequentialLanes(2);
 }
 
 TEST_CASE("BarLabels")
@@ -38,4 +39,154 @@ TEST_CASE("BarLabels")
 	CHECK(labels.read().data() == std::string("READ 1"));
 	CHECK(labels.full().data() == std::string("FULL 2"));
 	CHECK(labels.none().data() == std::string("NONE 4"));
+	CHECK(labels.sequential.data() == std::string("sequential 1"));
+	CHECK(labels.cacheHits.empty());
+	CHECK(labels.cacheMisses.empty());
+
+	sortvis::Sorter cached(sortabels, BarGen);
+	cached.simulateCache(std::make_unique<sortvis::CacheSimulator>(sortvis::CacheSimulator::typical()));
+	while(cached.advance()) {}
+
+	labels.update(cached);
+
+	REQUIRE(labels.cacheHits.size() == 3);
+	REQUIRE(labels.cacheMisses.size() == 3);
+	const uint64_t hits = cached.cacheSimulator()->levels()[0].hits();
+	CHECK(hits > 0);
+	CHECK(labels.cacheHits[0].data() == "L1 hit " + std::to_string(hits));
+	CHECK(labels.cacheMisses[0].data() == std::string("L1 miss 1"));
+	CHECK(labels.cacheHits[2].data() == std::string("LLC hit 0"));
+}
+
+TEST_CASE("BarColumns::aggregate")
+{
+	using Display = sortvis::BarColumns::Display;
+
+	sortvis::SortableCollection sortables{{5, 1, 7, 3, 8, 2, 6, 4}};
+	sortables.state(sortvis::Sortable::SortState::Full, 0U, 1U, 2U);
+	sortables.state(sortvis::Sortable::AccessState::Read, 5U);
+
+	sortvis::BarColumns columns;
+
+	columns.aggregate(sortables, 2);
+
+	REQUIRE(columns.size() == 2);
+	CHECK(columns.width() == 4.0);
+	CHECK(columns[0].min == 1);
+	CHECK(columns[0].max == 7);
+	CHECK(columns[0].display == Display::Full);
+	CHECK(columns[1].min == 2);
+	CHECK(columns[1].max == 8);
+	CHECK(columns[1].display == Display::Read);
+
+	sortables.state(sortvis::Sortable::AccessState::Write, 6U);
+	columns.aggregate(sortables, 3);
+
+	REQUIRE(columns.size() == 3);
+	CHECK(columns[0].display == Display::Full);
+	CHECK(columns[1].display == Display::None);
+	CHECK(columns[1].min == 3);
+	CHECK(columns[1].max == 8);
+	CHECK(columns[2].display == Display::Write);
+
+	columns.aggregate(sortables, 100);
+
+	CHECK(columns.size() == sortables.size());
+	CHECK(columns.width() == 1.0);
+}
+
+TEST_CASE("BarColumns::display")
+{
+	using Display = sortvis::BarColumns::Display;
+	using AccessState = sortvis::Sortable::AccessState;
+	using SortState = sortvis::Sortable::SortState;
+
+	CHECK(sortvis::BarColumns::display({1, SortState::Full, AccessState::Write}) == Display::Write);
+	CHECK(sortvis::BarColumns::display({1, SortState::None, AccessState::Read}) == Display::Read);
+	CHECK(sortvis::BarColumns::display({1, SortState::Full, AccessState::None}) == Display::Full);
+	CHECK(sortvis::BarColumns::display({1, SortState::Partial, AccessState::None}) == Display::None);
+}
+
+TEST_CASE("BarColumns span")
+{
+	using Display = sortvis::BarColumns::Display;
+
+	const sortvis::BarColumns::Column single =
+	    sortvis::BarColumns::single({4, sortvis::Sortable::SortState::None, sortvis::Sortable::AccessState::Read});
+	CHECK(single.min == 4);
+	CHECK(single.max == 4);
+	CHECK(single.display == Display::Read);
+
+	// a sorted column only spans its own values, a shuffled one almost the whole range
+	sortvis::SortableCollection sortables(64);
+	sortvis::BarColumns columns;
+	columns.aggregate(sortables, 4);
+
+	for(size_t col = 0; col < columns.size(); ++col)
+	{
+		CHECK(columns[col].max - columns[col].min == 15);
+	}
+
+	sortables.randomize(7);
+	columns.aggregate(sortables, 4);
+
+	for(size_t col = 0; col < columns.size(); ++col)
+	{
+		CHECK(columns[col].max - columns[col].min > 32);
+	}
+}
+
+TEST_CASE("BarColumns::update")
+{
+	sortvis::SortableCollection sortables{{6, 5, 4, 3, 2, 1}};
+	sortvis::Sorter sorter(sortables, sortvis::algorithms::bubble);
+
+	sortvis::BarColumns columns;
+
+	CHECK(columns.update(sorter, 3));
+	CHECK_FALSE(columns.update(sorter, 3));
+	CHECK(columns.update(sorter, 2));
+
+	sorter.advance();
+
+	CHECK(columns.update(sorter, 2));
+	CHECK_FALSE(columns.update(sorter, 2));
+
+	sorter.reset(sortables);
+
+	CHECK(columns.update(sorter, 2));
+	CHECK(columns[0].max == 6);
+	CHECK(columns[1].max == 3);
+}
+
+TEST_CASE("BarColumns::update incremental")
+{
+	sortvis::SortableCollection sortables(64);
+	sortables.randomize(7);
+	sortvis::Sorter sorter(sortables, sortvis::algorithms::quick);
+
+	sortvis::BarColumns columns;
+	sortvis::BarColumns reference;
+
+	while(sorter.advance())
+	{
+		columns.update(sorter, 5);
+		reference.aggregate(sorter.data(), 5);
+
+		for(size_t col = 0; col < reference.size(); ++col)
+		{
+			REQUIRE(columns[col].min == reference[col].min);
+			REQUIRE(columns[col].max == reference[col].max);
+			REQUIRE(columns[col].display == reference[col].display);
+		}
+	}
+}
+
+TEST_CASE("NumberedString 64bit")
+{
+	sortvis::NumberedString numstr("compare ");
+
+	numstr.update(UINT64_MAX);
+
+	CHECK(numstr.data() == std::string("compare 18446744073709551615"));
 }
@@ -0,0 +1,126 @@
+#include "headless.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("headless::parseArguments")
+{
+	const std::vector<std::string_view> args{"--headless", "--algorithms", "Heap Sort,Tim Sort", "--sizes", "10,200",
+	    "--seeds", "3,4,5", "--inputs", "sorted,few unique", "--format", "json", "--max-steps", "99", "--threads",
+	    "2"};
+	const sortvis::headless::Options options = sortvis::headless::parseArguments(args);
+	CHECK(options.algorithms == std::vector<std::string>{"Heap Sort", "Tim Sort"});
+	CHECK(options.sizes == std::vector<size_t>{10, 200});
+	CHECK(options.seeds == std::vector<uint64_t>{3, 4, 5});
+	CHECK(options.inputs == std::vector<sortvis::Distribution>{
+	                            sortvis::Distribution::Sorted, sortvis::Distribution::FewUnique});
+	CHECK(options.format == sortvis::headless::Format::Json);
+	CHECK(options.maxSteps == 99);
+	CHECK(options.threads == 2);
+
+	const sortvis::headless::Options defaults = sortvis::headless::parseArguments({});
+	CHECK(defaults.algorithms.empty());
+	CHECK(defaults.format == sortvis::headless::Format::Csv);
+	CHECK(defaults.maxSteps == SIZE_MAX);
+
+	using Args = std::vector<std::string_view>;
+	CHECK_THROWS_AS(sortvis::headless::parseArguments(Args{"--sizes"}), std::invalid_argument);
+	CHECK_THROWS_AS(sortvis::headless::parseArguments(Args{"--sizes", "10,x"}), std::invalid_argument);
+	CHECK_THROWS_AS(sortvis::headless::parseArguments(Args{"--sizes", "-1"}), std::invalid_argument);
+	CHECK_THROWS_AS(sortvis::headless::parseArguments(Args{"--inputs", "shuffled"}), std::invalid_argument);
+	CHECK_THROWS_AS(sortvis::headless::parseArguments(Args{"--format", "xml"}), std::invalid_argument);
+	CHECK_THROWS_AS(sortvis::headless::parseArguments(Args{"--window", "1"}), std::invalid_argument);
+}
+
+TEST_CASE("headless::run")
+{
+	sortvis::headless::Options options;
+	options.algorithms = {"Quick Sort (3-Way)", "Tim Sort"};
+	options.sizes = {100, 1000};
+	options.seeds = {1, 2};
+	options.inputs = {sortvis::Distribution::Random, sortvis::Distribution::Sorted};
+	options.plugins = "missing-plugin-directory";
+
+	std::ostringstream csv;
+	sortvis::headless::RunWriter csvWriter(csv, options.format);
+	CHECK(sortvis::headless::run(options, csvWriter) == 0);
+
+	std::istringstream lines(csv.str());
+	std::string line;
+	std::getline(lines, line);
+	CHECK(line == "algorithm,input,elements,seed,steps,compares,swaps,reads,writes,vector_ops,peak_aux_bytes,seconds,"
+	              "finished,sorted");
+	size_t rows = 0;
+	while(std::getline(lines, line))
+	{
+		++rows;
+		CHECK(std::count(line.begin(), line.end(), ',') == 13);
+		CHECK(line.ends_with(",true,true"));
+	}
+	CHECK(rows == 16);
+	CHECK(csv.str().find("\"Tim Sort\",\"sorted\",1000,2,") != std::string::npos);
+
+	// merge & radix sorts move elements through aux arrays, their work shows up as reads & writes only
+	options.algorithms = {"Bottom-Up Merge Sort", "LSD Radix Sort"};
+	options.sizes = {100};
+	options.seeds = {1};
+	options.inputs = {sortvis::Distribution::Random};
+	std::ostringstream aux;
+	sortvis::headless::RunWriter auxWriter(aux, options.format);
+	CHECK(sortvis::headless::run(options, auxWriter) == 0);
+
+	std::istringstream auxLines(aux.str());
+	std::getline(auxLines, line);
+	rows = 0;
+	while(std::getline(auxLines, line))
+	{
+		++rows;
+		std::vector<std::string> fields;
+		std::istringstream row(line);
+		for(std::string field; std::getline(row, field, ',');)
+		{
+			fields.push_back(field);
+		}
+		REQUIRE(fields.size() == 14);
+		CHECK(fields[7] != "0");
+		CHECK(fields[8] != "0");
+		CHECK(fields[10] != "0");
+	}
+	CHECK(rows == 2);
+	options.algorithms = {"Quick Sort (3-Way)", "Tim Sort"};
+
+	options.format = sortvis::headless::Format::Json;
+	options.sizes = {1000};
+	options.seeds = {1};
+	options.inputs = {sortvis::Distribution::Reversed};
+	options.maxSteps = 10;
+	std::ostringstream json;
+	sortvis::headless::RunWriter jsonWriter(json, options.format);
+	CHECK(sortvis::headless::run(options, jsonWriter) == 0);
+	CHECK(json.str().starts_with("[\n  {\"algorithm\": \"Quick Sort (3-Way)\", \"input\": \"reversed\", "
+	                             "\"elements\": 1000, \"seed\": 1, \"steps\": 10, "));
+	CHECK(json.str().find("\"reads\": ") != std::string::npos);
+	CHECK(json.str().find("\"peak_aux_bytes\": ") != std::string::npos);
+	CHECK(json.str().ends_with("\"finished\": false, \"sorted\": false}\n]\n"));
+
+	// every algorithm copes with the smallest sizes
+	options.algorithms.clear();
+	options.sizes = {0, 1, 2};
+	options.maxSteps = SIZE_MAX;
+	std::ostringstream small;
+	sortvis::headless::RunWriter smallWriter(small, options.format);
+	CHECK(sortvis::headless::run(options, smallWriter) == 0);
+	CHECK(small.str().find("\"finished\": false") == std::string::npos);
+
+	options.algorithms = {"Unknown Sort"};
+	std::ostringstream unknown;
+	sortvis::headless::RunWriter unknownWriter(unknown, options.format);
+	CHECK_THROWS_AS(sortvis::headless::run(options, unknownWriter), std::invalid_argument);
+	CHECK(unknown.str().empty());
+}
@@ -0,0 +1,139 @@
+#include "sorter.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("Lane::join")
+{
+	sortvis::SortableCollection data{{4, 3, 2, 1, 8, 7, 6, 5}};
+	data.acknowledgeChanges();
+	std::vector<sortvis::Lane> lanes{{data, 0}, {data, 1}};
+
+	lanes[0].retarget(0, 4);
+	lanes[1].retarget(4, 4);
+
+	CHECK(lanes[0].greater(0, 3));
+	lanes[0].swap(0, 3);
+	lanes[1].swap(1, 2);
+	lanes[1].state(sortvis::Sortable::SortState::Full, size_t(0));
+
+	CHECK(data.getCounter(sortvis::Sortable::AccessState::Write) == 0);
+	CHECK(data[0].value == 1);
+	CHECK(data[5].value == 6);
+
+	sortvis::Lane::join(data, lanes);
+
+	CHECK(data.getCounter(sortvis::Sortable::AccessState::Read) == 1);
+	CHECK(data.getCounter(sortvis::Sortable::AccessState::Write) == 2);
+	CHECK(data.getCounter(sortvis::Sortable::SortState::Full) == 1);
+	CHECK(data.getDistances(sortvis::Sortable::AccessState::Write)[1] == 1);
+	CHECK(data.getDistances(sortvis::Sortable::AccessState::Write)[2] == 1);
+
+	REQUIRE(data.changes().get().size() == 1);
+	CHECK(data.changes().get()[0].first == 0);
+	CHECK(data.changes().get()[0].last == 7);
+
+	REQUIRE(data.cursors().size() == 2);
+	CHECK(data.cursors()[0] == 0);
+	CHECK(data.cursors()[1] == 5);
+
+	lanes[1].retarget(0, 0);
+	sortvis::Lane::join(data, lanes);
+
+	CHECK(data.cursors()[1] == sortvis::SortableCollection::NO_CURSOR);
+}
+
+TEST_CASE("Lane::lessThanShared")
+{
+	sortvis::SortableCollection data{{5, 1, 9, 3}};
+	sortvis::Lane lane(data, 0);
+	lane.retarget(0, 3);
+
+	CHECK(lane.lessThanShared(1, 3));
+	CHECK_FALSE(lane.lessThanShared(2, 3));
+	CHECK(data[1] == sortvis::Sortable::AccessState::Read);
+	CHECK(data[3] == sortvis::Sortable::AccessState::None);
+}
+
+TEST_CASE("parallel traced")
+{
+	sortvis::algorithms::setParallelLanes(4);
+
+	sortvis::SortableCollection sortables(500);
+	sortables.randomize(99);
+
+	for(sortvis::SorterAlgorithm algorithm : {sortvis::algorithms::parallelMerge, sortvis::algorithms::parallelSample})
+	{
+		for(size_t batch : {size_t(1), sortvis::algorithms::DEFAULT_PARALLEL_BATCH})
+		{
+			sortvis::algorithms::setParallelBatch(batch);
+			sortvis::Sorter direct(sortables, algorithm);
+			sortvis::Sorter traced(sortables, algorithm, sortvis::Sorter::Mode::Traced);
+
+			while(direct.advance()) {}
+			while(!traced.hasFinished())
+			{
+				traced.advance();
+			}
+
+			CHECK(traced.step() == direct.step());
+			CHECK(traced.data() == direct.data());
+			CHECK(traced.data().getCounter(sortvis::Sortable::AccessState::Read) ==
+			      direct.data().getCounter(sortvis::Sortable::AccessState::Read));
+			CHECK(traced.data().getCounter(sortvis::Sortable::AccessState::Write) ==
+			      direct.data().getCounter(sortvis::Sortable::AccessState::Write));
+			CHECK(std::equal(traced.data().cursors().begin(), traced.data().cursors().end(),
+			    direct.data().cursors().begin(), direct.data().cursors().end()));
+
+			traced.seek(batch == 1 ? traced.step() / 2 : 1); // lanes that finish hide their cursor
+
+			CHECK(std::any_of(traced.data().cursors().begin(), traced.data().cursors().end(),
+			    [](size_t cursor)
+			    {
+				    return cursor != sortvis::SortableCollection::NO_CURSOR;
+			    }));
+		}
+	}
+
+	sortvis::algorithms::setParallelBatch(sortvis::algorithms::DEFAULT_PARALLEL_BATCH);
+	sortvis::algorithms::setParallelLanes(0);
+}
+
+TEST_CASE("parallel sequential fallback")
+{
+	sortvis::algorithms::setParallelLanes(4);
+
+	sortvis::SortableCollection sortables(500);
+	sortables.randomize(99);
+
+	sortvis::Sorter parallel(sortables, sortvis::algorithms::parallelMerge);
+	while(parallel.advance()) {}
+
+	CHECK(parallel.data().getSequentialLaneSteps() == 0);
+
+	// Sorters of a SorterCollection advance inside ThreadPool tasks, their lanes cannot start more threads
+	sortvis::Sorter nested(sortables, sortvis::algorithms::parallelMerge);
+	sortvis::ThreadPool pool(2);
+	pool.run(1,
+	    [&nested](size_t)
+	    {
+		    while(nested.advance()) {}
+	    });
+
+	CHECK(nested.data() == parallel.data());
+	CHECK(nested.data().getSequentialLaneSteps() > 0);
+
+	sortvis::SortableCollection recorded{{2, 1}};
+	sortvis::SortableCollection replayed{{2, 1}};
+	sortvis::OperationTrace trace;
+	recorded.attach(&trace);
+	recorded.sequentialLanes(4);
+	trace.endStep(true);
+	replayed.apply(trace.chunk(0)[0]);
+
+	CHECK(replayed.getSequentialLaneSteps() == 1);
+
+	sortvis::algorithms::setParallelLanes(0);
+}
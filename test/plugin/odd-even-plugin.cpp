@@ -0,0 +1,53 @@
+#include "registry.hpp"
+
+namespace
+{
+/**
+ * @brief odd-even transposition sort, compares all even then all odd neighbours until a pass swaps nothing
+ *
+ */
+sortvis::Generator<const int> oddEven(std::shared_ptr<sortvis::SortableCollection> data)
+{
+	using sortvis::algorithms::COMP_MAGIC_VALUE;
+	using sortvis::algorithms::SWAP_MAGIC_VALUE;
+
+	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
+
+	bool changed = true;
+	while(changed)
+	{
+		changed = false;
+		for(size_t parity = 0; parity < 2; ++parity)
+		{
+			for(size_t i = parity; i + 1 < data->size(); i += 2)
+			{
+				const bool isLess = data->less(i + 1, i);
+				co_yield COMP_MAGIC_VALUE;
+				data->state(sortvis::Sortable::AccessState::None, i, i + 1);
+
+				if(isLess)
+				{
+					data->swap(i + 1, i);
+					co_yield SWAP_MAGIC_VALUE;
+					data->state(sortvis::Sortable::AccessState::None, i, i + 1);
+					changed = true;
+				}
+			}
+		}
+	}
+
+	for(size_t i = 0; i < data->size(); ++i)
+	{
+		data->state(sortvis::Sortable::SortState::Full, i);
+	}
+}
+
+const sortvis::AlgorithmInfo ALGORITHMS[]{
+    {"Odd-Even Sort", oddEven, nullptr, true, sortvis::AuxMemory::Constant, 10'000}};
+} // namespace
+
+SORTVIS_PLUGIN_ENTRY sortvisPlugin()
+{
+	static const sortvis::PluginManifest manifest{.algorithms = ALGORITHMS, .count = std::size(ALGORITHMS)};
+	return &manifest;
+}
@@ -0,0 +1,76 @@
+#include "registry.hpp"
+#include "sorter.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string_view>
+
+TEST_CASE("registeredAlgorithms")
+{
+	const std::vector<sortvis::AlgorithmInfo> algorithms = sortvis::registeredAlgorithms();
+	REQUIRE(algorithms.size() >= 17);
+	CHECK(algorithms.front().algorithm == sortvis::algorithms::bubble);
+	CHECK(sortvis::registeredSorterAlgorithms().size() == algorithms.size());
+
+	const sortvis::AlgorithmInfo* tim = sortvis::findAlgorithm(sortvis::algorithms::tim);
+	REQUIRE(tim != nullptr);
+	CHECK(std::string_view(tim->name) == "Tim Sort");
+	CHECK(tim->native == sortvis::algorithms::native::tim);
+	CHECK(tim->stable);
+	CHECK(tim->auxMemory == sortvis::AuxMemory::Linear);
+	CHECK(sortvis::findAlgorithm("Tim Sort") == tim);
+
+	const sortvis::AlgorithmInfo* heap = sortvis::findAlgorithm(sortvis::algorithms::heap);
+	REQUIRE(heap != nullptr);
+	CHECK_FALSE(heap->stable);
+	CHECK(heap->auxMemory == sortvis::AuxMemory::Constant);
+
+	// the blocks are merged through an n element buffer
+	const sortvis::AlgorithmInfo* bitonic = sortvis::findAlgorithm(sortvis::algorithms::bitonic);
+	REQUIRE(bitonic != nullptr);
+	CHECK(bitonic->auxMemory == sortvis::AuxMemory::Linear);
+
+	// the plain quick sort is quadratic on sorted input just like bubble sort
+	const sortvis::AlgorithmInfo* quick = sortvis::findAlgorithm(sortvis::algorithms::quick);
+	REQUIRE(quick != nullptr);
+	CHECK(quick->maxElements == algorithms.front().maxElements);
+
+	CHECK(sortvis::findAlgorithm("Unknown Sort") == nullptr);
+	CHECK(std::string_view(sortvis::getAlgorithmName(sortvis::algorithms::pdq)) == "Pattern Defeating Quick Sort");
+	CHECK(sortvis::getNativeAlgorithm(sortvis::algorithms::parallelMerge) == nullptr);
+	CHECK(std::string_view(sortvis::getAuxMemoryName(sortvis::AuxMemory::Logarithmic)) == "O(log n)");
+}
+
+TEST_CASE("registerAlgorithm")
+{
+	CHECK_THROWS_AS(sortvis::registerAlgorithm({"Bubble Sort", sortvis::algorithms::shell}), sortvis::PluginException);
+	CHECK_THROWS_AS(sortvis::registerAlgorithm({"Another Sort", sortvis::algorithms::shell}), sortvis::PluginException);
+	CHECK_THROWS_AS(sortvis::registerAlgorithm({"Null Sort", nullptr}), sortvis::PluginException);
+	CHECK(sortvis::findAlgorithm("Another Sort") == nullptr);
+}
+
+TEST_CASE("loadPlugin")
+{
+	CHECK_THROWS_AS(sortvis::loadPlugin("missing-plugin.so"), sortvis::PluginException);
+	CHECK(sortvis::loadPlugins("missing-plugin-directory") == 0);
+
+#ifdef SORTVIS_TEST_PLUGIN
+	if(sortvis::findAlgorithm("Odd-Even Sort") == nullptr)
+	{
+		CHECK(sortvis::loadPlugin(SORTVIS_TEST_PLUGIN) == 1);
+	}
+	CHECK_THROWS_AS(sortvis::loadPlugin(SORTVIS_TEST_PLUGIN), sortvis::PluginException);
+
+	const sortvis::AlgorithmInfo* oddEven = sortvis::findAlgorithm("Odd-Even Sort");
+	REQUIRE(oddEven != nullptr);
+	CHECK(oddEven->stable);
+	CHECK(sortvis::registeredAlgorithms().back().algorithm == oddEven->algorithm);
+
+	const sortvis::SortableCollection input{9, 3, 7, 1, 8, 2, 6, 4, 5, 10};
+	sortvis::Sorter sorter(input, oddEven->algorithm);
+	while(sorter.advance()) {}
+	CHECK(std::is_sorted(sorter.data().values().begin(), sorter.data().values().end()));
+	CHECK(sorter.data().getCounter(sortvis::Sortable::AccessState::Read) > 0);
+#endif
+}
@@ -113,6 +113,22 @@ TEST_CASE("SortableCollection::randomize(seed)")
 	seededB.randomize(seedB);
 
 	CHECK(seededA == seededB);
+
+	constexpr int MIN = std::numeric_limits<int>::min();
+	constexpr int MAX = std::numeric_limits<int>::max();
+	sortvis::SortableCollection custom{-5, 40, 40, 7, 0, 13, -5, 99, MAX, 1 << 24, -70000, MIN};
+	sortvis::SortableCollection reordered{MIN, 99, 40, -5, 13, -70000, 0, 7, 1 << 24, 40, MAX, -5};
+	std::vector<int> expected(custom.values().begin(), custom.values().end());
+	std::sort(expected.begin(), expected.end());
+
+	custom.randomize(seedA);
+	reordered.randomize(seedA);
+
+	std::vector<int> shuffled(custom.values().begin(), custom.values().end());
+	std::sort(shuffled.begin(), shuffled.end());
+
+	CHECK(shuffled == expected);
+	CHECK(custom == reordered);
 }
 
 TEST_CASE("SortableCollection::reset")
@@ -136,6 +152,29 @@ TEST_CASE("SortableCollection::reset")
 	CHECK(sortablesA.getCounter(sortvis::Sortable::AccessState::Read) == 0);
 }
 
+TEST_CASE("SortableCollection::reset shares values")
+{
+	sortvis::SortableCollection initial(100'000);
+	initial.randomize(5);
+
+	sortvis::SortableCollection sortables(initial);
+	sortables.reset(initial);
+
+	CHECK(sortables.values().ownedChunks() == 0);
+
+	sortables.swap(0, 1);
+
+	CHECK(sortables.values().ownedChunks() == 1);
+	CHECK(sortables != initial);
+	CHECK(sortables[0].value == initial[1].value);
+
+	sortables.reset(initial);
+
+	CHECK(sortables.values().ownedChunks() == 0);
+	CHECK(sortables == initial);
+	CHECK(sortables[0] == sortvis::Sortable::AccessState::None);
+}
+
 TEST_CASE("SortableCollection::less")
 {
 	const std::initializer_list<int> initial = {1, 2, 3, 4, 5, 6};
@@ -208,6 +247,112 @@ TEST_CASE("SortableCollection::swap")
 	REQUIRE(sortables.getCounter(sortvis::Sortable::SortState::Full) == 0);
 }
 
+TEST_CASE("SortableCollection::compareExchange")
+{
+	sortvis::SortableCollection sortables({6, 1, 5, 2, 4, 3});
+
+	const std::array<size_t, 3> lhs{0, 2, 3};
+	const std::array<size_t, 3> rhs{1, 4, 5};
+	sortables.compareExchange(lhs, rhs);
+
+	REQUIRE(sortables.values()[0] == 1);
+	REQUIRE(sortables.values()[1] == 6);
+	REQUIRE(sortables.values()[2] == 4);
+	REQUIRE(sortables.values()[4] == 5);
+	REQUIRE(sortables.values()[3] == 2);
+	REQUIRE(sortables.values()[5] == 3);
+	REQUIRE(sortables.getVectorOps() == 1);
+	REQUIRE(sortables.getCounter(sortvis::Sortable::AccessState::Read) == 3);
+	REQUIRE(sortables.getCounter(sortvis::Sortable::AccessState::Write) == 2);
+	REQUIRE(sortables[0] == sortvis::Sortable::AccessState::Write);
+	REQUIRE(sortables[2] == sortvis::Sortable::AccessState::Write);
+	REQUIRE(sortables[3] == sortvis::Sortable::AccessState::Read);
+	REQUIRE(sortables[5] == sortvis::Sortable::AccessState::Read);
+
+	sortvis::SortableCollection replayed({6, 1, 5, 2, 4, 3});
+	sortvis::OperationTrace trace;
+	sortables.reset(replayed);
+	sortables.attach(&trace);
+	sortables.compareExchange(lhs, rhs);
+	trace.endStep(true);
+
+	for(size_t i = 0; i + 1 < trace.size(); ++i)
+	{
+		replayed.apply(trace.chunk(0)[i]);
+	}
+	REQUIRE(replayed == sortables);
+	REQUIRE(replayed.getVectorOps() == 1);
+	REQUIRE(replayed.getCounter(sortvis::Sortable::AccessState::Write) == 2);
+}
+
+TEST_CASE("SortableCollection::read & write")
+{
+	sortvis::SortableCollection sortables({4, 3, 2, 1});
+	sortvis::OperationTrace trace;
+	sortables.attach(&trace);
+
+	const size_t aux = sortables.allocate(2);
+
+	REQUIRE(aux != sortvis::SortableCollection::MAIN_BUFFER);
+	REQUIRE(sortables.auxiliaries().size() == 1);
+	REQUIRE(sortables.auxiliaries()[0].size() == 2);
+
+	sortables.write(aux, 1, sortables.read(0));
+	sortables.write(0, sortables.read(3));
+	sortables.write(3, sortables.read(aux, 1));
+
+	REQUIRE(sortables.values()[0] == 1);
+	REQUIRE(sortables.values()[3] == 4);
+	REQUIRE(sortables.auxiliaries()[0].values()[1] == 4);
+	REQUIRE(sortables.getReads() == 3);
+	REQUIRE(sortables.getWrites() == 3);
+	REQUIRE(sortables.getCounter(sortvis::Sortable::AccessState::Read) == 0);
+	REQUIRE(sortables[0] == sortvis::Sortable::AccessState::Write);
+	REQUIRE(sortables.auxiliaries()[0][1] == sortvis::Sortable::AccessState::Read);
+
+	sortables.bufferState(aux, sortvis::Sortable::AccessState::None, 1);
+	REQUIRE(sortables.auxiliaries()[0][1] == sortvis::Sortable::AccessState::None);
+
+	sortables.release(aux);
+	REQUIRE(sortables.auxiliaries().empty());
+	trace.endStep(true);
+
+	sortvis::SortableCollection replayed({4, 3, 2, 1});
+	for(size_t i = 0; i + 1 < trace.size(); ++i)
+	{
+		replayed.apply(trace.chunk(0)[i]);
+		if(i == 6)
+		{
+			REQUIRE(replayed.auxiliaries().size() == 1);
+			REQUIRE(replayed.auxiliaries()[0].values()[1] == 4);
+		}
+	}
+	REQUIRE(replayed == sortables);
+	REQUIRE(replayed.getReads() == 3);
+	REQUIRE(replayed.getWrites() == 3);
+	REQUIRE(replayed.auxiliaries().empty());
+}
+
+TEST_CASE("SortableCollection::getPeakAuxBytes")
+{
+	sortvis::SortableCollection sortables({4, 3, 2, 1});
+
+	const size_t lower = sortables.allocate(2);
+	const size_t upper = sortables.allocate(3);
+	REQUIRE(sortables.getAuxBytes() == 5 * sizeof(int));
+
+	sortables.release(upper);
+	REQUIRE(sortables.getAuxBytes() == 2 * sizeof(int));
+	sortables.release(sortables.allocate(1));
+	sortables.release(lower);
+
+	REQUIRE(sortables.getAuxBytes() == 0);
+	REQUIRE(sortables.getPeakAuxBytes() == 5 * sizeof(int));
+
+	sortables.reset(sortvis::SortableCollection({4, 3, 2, 1}));
+	REQUIRE(sortables.getPeakAuxBytes() == 0);
+}
+
 TEST_CASE("SortableCollection::state")
 {
 	const std::initializer_list<int> initial = {1, 2, 3, 4, 5, 6};
@@ -234,3 +379,79 @@ TEST_CASE("SortableCollection::state")
 	REQUIRE(sortables[0] == sortvis::Sortable::SortState::Full);
 	REQUIRE(sortables[1] == sortvis::Sortable::SortState::Full);
 }
+
+TEST_CASE("SortableCollection::values")
+{
+	const std::initializer_list<int> initial = {6, 4, 5, 2, 1, 3};
+
+	sortvis::SortableCollection sortables(initial);
+
+	sortables.swap(0, 5);
+	sortables.state(sortvis::Sortable::SortState::Full, 0U);
+
+	const std::vector<int> actual(sortables.values().begin(), sortables.values().end());
+
+	CHECK(actual == std::initializer_list<int>{3, 4, 5, 2, 1, 6});
+	CHECK(sortables[0].value == 3);
+	CHECK(sortables[0] == sortvis::Sortable::SortState::Full);
+	CHECK(sortables[5] == sortvis::Sortable::AccessState::Write);
+	CHECK(sortables[5] == sortvis::Sortable::SortState::None);
+}
+
+TEST_CASE("SortableCollection::changes")
+{
+	sortvis::SortableCollection sortables{6, 4, 5, 2, 1, 3, 8, 7};
+
+	CHECK(sortables.changes().all());
+
+	sortables.acknowledgeChanges();
+
+	CHECK(sortables.changes().empty());
+
+	sortables.swap(0, 1);
+	sortables.less(6, 7);
+	sortables.state(sortvis::Sortable::SortState::Full, 3U);
+
+	REQUIRE(sortables.changes().get().size() == 3);
+	CHECK(sortables.changes().get()[0].first == 0);
+	CHECK(sortables.changes().get()[0].last == 2);
+	CHECK(sortables.changes().get()[1].first == 3);
+	CHECK(sortables.changes().get()[2].last == 8);
+
+	sortables.acknowledgeChanges();
+	sortables.randomize(1);
+
+	CHECK(sortables.changes().all());
+
+	sortables.acknowledgeChanges();
+	sortvis::SortableCollection copy(sortables);
+
+	CHECK(copy.changes().all());
+	CHECK(sortables.changes().empty());
+}
+
+TEST_CASE("SortableCollection::getDistances")
+{
+	sortvis::SortableCollection sortables(64);
+
+	sortables.less(3, 3);
+	sortables.less(4, 5);
+	sortables.greater(10, 2);
+	sortables.swap(0, 63);
+	sortables.swap(7, 6);
+
+	const auto& compares = sortables.getDistances(sortvis::Sortable::AccessState::Read);
+	const auto& swaps = sortables.getDistances(sortvis::Sortable::AccessState::Write);
+
+	CHECK(compares[0] == 1);
+	CHECK(compares[1] == 1);
+	CHECK(compares[4] == 1);
+	CHECK(swaps[1] == 1);
+	CHECK(swaps[6] == 1);
+	CHECK(std::accumulate(compares.begin(), compares.end(), uint64_t(0)) == 3);
+
+	sortables.reset(sortvis::SortableCollection(64));
+
+	CHECK(sortables.getDistances(sortvis::Sortable::AccessState::Read)[4] == 0);
+	CHECK(sortables.getDistances(sortvis::Sortable::AccessState::Write)[6] == 0);
+}
@@ -2,7 +2,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
-cppcoro::generator<const int> EarlyFinishGen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> EarlyFinishGen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	if(data->size() == 0) //! should not be hit
 	{
@@ -10,19 +10,19 @@ cppcoro::generator<const int> EarlyFinishGen(std::shared_ptr<sortvis::SortableCo
 	}
 }
 
-cppcoro::generator<const int> NoInitValueGen(std::shared_ptr<sortvis::SortableCollection>)
+sortvis::Generator<const int> NoInitValueGen(std::shared_ptr<sortvis::SortableCollection>)
 {
 	co_yield sortvis::algorithms::SWAP_MAGIC_VALUE;
 }
 
-cppcoro::generator<const int> ChangedStateGen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> ChangedStateGen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	data->swap(0, 1);
 
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 }
 
-cppcoro::generator<const int> ValidGen(std::shared_ptr<sortvis::SortableCollection>)
+sortvis::Generator<const int> ValidGen(std::shared_ptr<sortvis::SortableCollection>)
 {
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 }
@@ -56,9 +56,26 @@ TEST_CASE("Sorter::Sorter")
 		CHECK(sorter->name() == std::string("Bubble Sort"));
 		CHECK(sorter->data() == sortables);
 	}
+
+	SECTION("MovedFrom")
+	{
+		sortvis::Sorter sorter(sortables, sortvis::algorithms::bubble);
+		sortvis::Sorter moved(std::move(sorter));
+
+		CHECK(sorter.hasFinished()); // NOLINT(bugprone-use-after-move)
+		CHECK_FALSE(sorter.advance());
+		CHECK_FALSE(sorter.advance(5));
+		CHECK(sorter.seek(3) == 0);
+		CHECK_FALSE(moved.hasFinished());
+		CHECK(moved.advance());
+
+		sorter = std::move(moved);
+		CHECK(sorter.step() == 1);
+		CHECK(sorter.advance());
+	}
 }
 
-cppcoro::generator<const int> AdvanceGen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> AdvanceGen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 
@@ -89,6 +106,153 @@ TEST_CASE("Sorter::advance")
 	CHECK_FALSE(sorter.advance());
 }
 
+TEST_CASE("Sorter::advance(steps)")
+{
+	sortvis::SortableCollection sortables({1, 5, 3, 2, 6, 4});
+
+	sortvis::Sorter sorter(sortables, AdvanceGen);
+
+	CHECK(sorter.advance(2));
+
+	REQUIRE(sorter.step() == 2);
+	REQUIRE(sorter[2] == sortables[3]);
+	REQUIRE(sorter[3] == sortables[2]);
+
+	CHECK_FALSE(sorter.advance(10));
+	CHECK(sorter.step() == 3);
+	CHECK_FALSE(sorter.advance(0));
+}
+
+TEST_CASE("Sorter::advanceUntil")
+{
+	sortvis::SortableCollection sortables(32, true);
+
+	sortvis::Sorter sorter(sortables, sortvis::algorithms::insertion);
+
+	CHECK(sorter.advanceUntil(
+	    [](const sortvis::Sorter& self)
+	    {
+		    return self.data().getCounter(sortvis::Sortable::AccessState::Write) == 10;
+	    }));
+	CHECK(sorter.data().getCounter(sortvis::Sortable::AccessState::Write) == 10);
+
+	CHECK_FALSE(sorter.advanceUntil(
+	    [](const sortvis::Sorter&)
+	    {
+		    return false;
+	    }));
+	CHECK(sorter.hasFinished());
+}
+
+TEST_CASE("Sorter::advance Traced")
+{
+	sortvis::SortableCollection sortables({1, 5, 3, 2, 6, 4});
+
+	sortvis::Sorter sorter(sortables, AdvanceGen, sortvis::Sorter::Mode::Traced);
+
+	while(sorter.advance() && sorter[0] == sortables[0]) {}
+
+	REQUIRE(sorter[0] == sortables[1]);
+	REQUIRE(sorter[1] == sortables[0]);
+	REQUIRE(sorter[2] == sortables[2]);
+
+	while(sorter.advance()) {}
+
+	REQUIRE(sorter[2] == sortables[3]);
+	REQUIRE(sorter[3] == sortables[2]);
+	CHECK(sorter.hasFinished());
+	CHECK(sorter.data().getCounter(sortvis::Sortable::AccessState::Write) == 2);
+}
+
+TEST_CASE("Sorter::Sorter Traced")
+{
+	sortvis::SortableCollection sortables({1, 2, 3, 4, 5, 6});
+
+	REQUIRE_THROWS_AS(
+	    sortvis::Sorter(sortables, EarlyFinishGen, sortvis::Sorter::Mode::Traced), sortvis::InitFailureException);
+	REQUIRE_THROWS_AS(
+	    sortvis::Sorter(sortables, ChangedStateGen, sortvis::Sorter::Mode::Traced), sortvis::InitFailureException);
+
+	sortvis::SortableCollection randomized(64, true);
+	sortvis::Sorter direct(randomized, sortvis::algorithms::heap);
+	sortvis::Sorter traced(randomized, sortvis::algorithms::heap, sortvis::Sorter::Mode::Traced);
+
+	while(direct.advance()) {}
+	while(traced.advance()) {}
+
+	CHECK(traced.data() == direct.data());
+	CHECK(traced.data().getCounter(sortvis::Sortable::AccessState::Read) ==
+	      direct.data().getCounter(sortvis::Sortable::AccessState::Read));
+	CHECK(traced.data().getCounter(sortvis::Sortable::AccessState::Write) ==
+	      direct.data().getCounter(sortvis::Sortable::AccessState::Write));
+	CHECK(traced.data().getCounter(sortvis::Sortable::SortState::Full) == randomized.size());
+}
+
+TEST_CASE("Sorter::seek")
+{
+	sortvis::SortableCollection sortables(32, true);
+
+	sortvis::Sorter sorter(sortables, sortvis::algorithms::quick, sortvis::Sorter::Mode::Traced);
+	sorter.setKeyframeInterval(8);
+
+	std::vector<std::vector<int>> history;
+	std::vector<uint64_t> compares;
+	history.emplace_back(sorter.data().values().begin(), sorter.data().values().end());
+	compares.push_back(0);
+	while(!sorter.hasFinished())
+	{
+		if(sorter.advance() || sorter.hasFinished())
+		{
+			if(sorter.step() == history.size())
+			{
+				history.emplace_back(sorter.data().values().begin(), sorter.data().values().end());
+				compares.push_back(sorter.data().getCounter(sortvis::Sortable::AccessState::Read));
+			}
+		}
+	}
+
+	const size_t last = sorter.step();
+	REQUIRE(history.size() == last + 1);
+	CHECK(sorter.recordedSteps() == last);
+
+	for(size_t target : {size_t(0), size_t(13), size_t(7), last / 2, last - 1, size_t(8), last})
+	{
+		CHECK(sorter.seek(target) == target);
+		CHECK(std::equal(history[target].begin(), history[target].end(), sorter.data().values().begin()));
+		CHECK(sorter.data().getCounter(sortvis::Sortable::AccessState::Read) == compares[target]);
+	}
+	CHECK(sorter.hasFinished());
+
+	CHECK(sorter.stepBack());
+	CHECK(sorter.step() == last - 1);
+	CHECK_FALSE(sorter.hasFinished());
+	CHECK(std::equal(history[last - 1].begin(), history[last - 1].end(), sorter.data().values().begin()));
+
+	CHECK(sorter.seek(last + 10) == last);
+	CHECK(sorter.hasFinished());
+
+	sortvis::Sorter direct(sortables, sortvis::algorithms::quick);
+	CHECK(direct.seek(5) == 5);
+	CHECK_FALSE(direct.stepBack());
+	CHECK(direct.seek(2) == 5);
+	CHECK(direct.firstStep() == 5);
+
+	// the oldest Keyframes & the Operations only they could replay are dropped
+	sortvis::SortableCollection large(5'000);
+	large.randomize(7);
+	sortvis::Sorter limited(large, sortvis::algorithms::heap, sortvis::Sorter::Mode::Traced);
+	limited.setKeyframeInterval(8);
+	limited.setKeyframeLimit(2);
+	while(limited.advance() || !limited.hasFinished()) {}
+	const size_t first = limited.firstStep();
+	CHECK(first > limited.step() - 16);
+	CHECK(first % 8 == 0);
+	CHECK(limited.seek(0) == first);
+	CHECK_FALSE(limited.stepBack());
+	CHECK(limited.seek(limited.recordedSteps()) == limited.recordedSteps());
+	CHECK(std::is_sorted(limited.data().values().begin(), limited.data().values().end()));
+}
+
 TEST_CASE("Sorter::reset")
 {
 	sortvis::SortableCollection sortablesA({3, 1, 2, 4, 5, 6});
@@ -129,16 +293,16 @@ TEST_CASE("SorterCollection::SorterCollection({}, {}")
 	CHECK(sorters[0].data() == sortables);
 }
 
-cppcoro::generator<const int> Advance1Gen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> Advance1Gen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 }
-cppcoro::generator<const int> Advance2Gen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> Advance2Gen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 	co_yield sortvis::algorithms::SWAP_MAGIC_VALUE;
 }
-cppcoro::generator<const int> Advance3Gen(std::shared_ptr<sortvis::SortableCollection> data)
+sortvis::Generator<const int> Advance3Gen(std::shared_ptr<sortvis::SortableCollection> data)
 {
 	co_yield sortvis::algorithms::INIT_MAGIC_VALUE;
 	co_yield sortvis::algorithms::SWAP_MAGIC_VALUE;
@@ -156,6 +320,77 @@ TEST_CASE("SorterCollection::advance")
 	REQUIRE_FALSE(sorters.advance());
 }
 
+TEST_CASE("SorterCollection::advance(steps)")
+{
+	sortvis::SortableCollection sortables({1, 5, 3, 2, 6, 4});
+
+	sortvis::SorterCollection sorters(sortables, {Advance1Gen, Advance3Gen, Advance2Gen});
+
+	REQUIRE(sorters.advance(2));
+	CHECK(sorters[0].step() == 1);
+	CHECK(sorters[1].step() == 2);
+	CHECK(sorters[2].step() == 2);
+	REQUIRE_FALSE(sorters.advance(2));
+	CHECK(sorters.step() == 3);
+}
+
+TEST_CASE("SorterCollection::advanceUntil")
+{
+	sortvis::SortableCollection sortables(64, true);
+
+	sortvis::SorterCollection sorters(sortables, {sortvis::algorithms::bubble, sortvis::algorithms::heap});
+
+	size_t checks = 0;
+	CHECK(sorters.advanceUntil(
+	    [&checks]
+	    {
+		    return ++checks > 3;
+	    },
+	    1000, 10));
+	CHECK(sorters.step() == 30);
+
+	CHECK(sorters.advanceUntil(std::chrono::steady_clock::now() + std::chrono::hours(1), 70));
+	CHECK(sorters.step() == 100);
+
+	CHECK(sorters.advanceUntil(std::chrono::steady_clock::now() - std::chrono::seconds(1), 70));
+	CHECK(sorters.step() == 100);
+
+	CHECK_FALSE(sorters.advanceUntil(std::chrono::steady_clock::time_point::max(), SIZE_MAX));
+}
+
+TEST_CASE("SorterCollection::setThreads")
+{
+	sortvis::SortableCollection sortables(256, true);
+	const std::initializer_list<sortvis::SorterAlgorithm> algorithms{sortvis::algorithms::bubble,
+	    sortvis::algorithms::quick, sortvis::algorithms::shell, sortvis::algorithms::heap,
+	    sortvis::algorithms::insertion, sortvis::algorithms::selection, sortvis::algorithms::parallelMerge,
+	    sortvis::algorithms::parallelSample};
+
+	sortvis::SorterCollection sequential(sortables, algorithms);
+	sortvis::SorterCollection parallel(sortables, algorithms);
+
+	parallel.setThreads(4);
+	REQUIRE(parallel.threads() == 4);
+
+	bool sequentialRunning = true;
+	bool parallelRunning = true;
+	while(sequentialRunning || parallelRunning)
+	{
+		sequentialRunning = sequential.advance(7);
+		parallelRunning = parallel.advance(7);
+		REQUIRE(sequentialRunning == parallelRunning);
+	}
+
+	for(size_t i = 0; i < parallel.size(); ++i)
+	{
+		CHECK(parallel[i].data() == sequential[i].data());
+		CHECK(parallel[i].step() == sequential[i].step());
+	}
+
+	parallel.setThreads(1);
+	CHECK(parallel.threads() == 1);
+}
+
 TEST_CASE("SorterCollection::reset")
 {
 	sortvis::SortableCollection sortablesA({3, 1, 2, 4, 5, 6});
@@ -172,3 +407,27 @@ TEST_CASE("SorterCollection::reset")
 
 	CHECK_FALSE(sorters.allHaveFinished());
 }
+
+TEST_CASE("SorterCollection::seek")
+{
+	sortvis::SortableCollection sortables({1, 5, 3, 2, 6, 4});
+
+	sortvis::SorterCollection sorters(
+	    sortables, {Advance1Gen, Advance3Gen, Advance2Gen}, sortvis::Sorter::Mode::Traced);
+
+	while(sorters.seek(5)) {}
+
+	CHECK(sorters.step() == 3);
+	CHECK(sorters.recordedSteps() == 3);
+	CHECK(sorters.allHaveFinished());
+
+	CHECK(sorters.stepBack());
+	CHECK(sorters.step() == 2);
+	CHECK_FALSE(sorters.allHaveFinished());
+	CHECK(sorters[0].step() == 1);
+	CHECK(sorters[1].step() == 2);
+
+	sorters.seek(0);
+	CHECK(sorters.step() == 0);
+	CHECK_FALSE(sorters.stepBack());
+}
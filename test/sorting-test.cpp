@@ -1,4 +1,9 @@
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <ostream>
+#include <random>
+#include <vector>
 
 #include "sorter.hpp"
 
@@ -27,6 +32,38 @@ const sortvis::SortableCollection SC_RND{3, 16, 14, 20, 4, 1, 11, 2, 18, 5, 9, 6
 
 const sortvis::SortableCollection* SC_ARR[]{&SC_ASC, &SC_DSC, &SC_GRP, &SC_RND};
 
+/**
+ * @brief sorts input directly & traced, checks the result is sorted & marked Full, no aux array is left
+ * and the replay matches the direct run in values & every counter
+ *
+ * @return sortvis::SortableCollection the directly sorted collection
+ */
+sortvis::SortableCollection checkTracedReplay(
+    const sortvis::SortableCollection& input, sortvis::SorterAlgorithm algorithm)
+{
+	sortvis::Sorter direct(input, algorithm);
+	sortvis::Sorter traced(input, algorithm, sortvis::Sorter::Mode::Traced);
+
+	while(direct.advance()) {}
+	while(traced.advance()) {}
+
+	CHECK(std::is_sorted(direct.data().values().begin(), direct.data().values().end()));
+	CHECK(direct.data().getCounter(sortvis::Sortable::SortState::Full) == input.size());
+	CHECK(direct.data().auxiliaries().empty());
+	CHECK(direct.data().getAuxBytes() == 0);
+	CHECK(traced.data() == direct.data());
+	CHECK(traced.data().getCounter(sortvis::Sortable::AccessState::Read) ==
+	      direct.data().getCounter(sortvis::Sortable::AccessState::Read));
+	CHECK(traced.data().getCounter(sortvis::Sortable::AccessState::Write) ==
+	      direct.data().getCounter(sortvis::Sortable::AccessState::Write));
+	CHECK(traced.data().getVectorOps() == direct.data().getVectorOps());
+	CHECK(traced.data().getReads() == direct.data().getReads());
+	CHECK(traced.data().getWrites() == direct.data().getWrites());
+	CHECK(traced.data().getPeakAuxBytes() == direct.data().getPeakAuxBytes());
+
+	return sortvis::SortableCollection(direct.data());
+}
+
 TEST_CASE("bubble")
 {
 	for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
@@ -53,13 +90,34 @@ TEST_CASE("insertion")
 
 TEST_CASE("shell")
 {
-	for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+	for(sortvis::SorterAlgorithm algorithm :
+	    {sortvis::algorithms::shell, sortvis::algorithms::tokudaShell, sortvis::algorithms::sedgewickShell})
 	{
-		sortvis::Sorter asc(*sc_ptr, sortvis::algorithms::shell);
+		for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+		{
+			sortvis::Sorter asc(*sc_ptr, algorithm);
 
-		while(asc.advance()) {}
+			while(asc.advance()) {}
 
-		CHECK(asc.data() == SC_ASC);
+			CHECK(asc.data() == SC_ASC);
+		}
+	}
+
+	using sortvis::algorithms::ShellGaps;
+	CHECK(sortvis::algorithms::shellGaps(ShellGaps::Ciura, 20) == std::vector<size_t>{10, 4, 1});
+	CHECK(sortvis::algorithms::shellGaps(ShellGaps::Ciura, 2000) ==
+	      std::vector<size_t>{1577, 701, 301, 132, 57, 23, 10, 4, 1});
+	CHECK(sortvis::algorithms::shellGaps(ShellGaps::Tokuda, 300) == std::vector<size_t>{233, 103, 46, 20, 9, 4, 1});
+	CHECK(sortvis::algorithms::shellGaps(ShellGaps::Sedgewick, 300) == std::vector<size_t>{281, 77, 23, 8, 1});
+	CHECK(sortvis::algorithms::shellGaps(ShellGaps::Sedgewick, 1) == std::vector<size_t>{1});
+
+	// the first pass of large inputs starts close to the size instead of at 701
+	for(ShellGaps sequence : {ShellGaps::Ciura, ShellGaps::Tokuda, ShellGaps::Sedgewick})
+	{
+		const std::vector<size_t> gaps = sortvis::algorithms::shellGaps(sequence, 1'000'000);
+		CHECK(gaps.front() > 200'000);
+		CHECK(gaps.front() < 1'000'000);
+		CHECK(std::is_sorted(gaps.rbegin(), gaps.rend()));
 	}
 }
 
@@ -76,10 +134,91 @@ TEST_CASE("selection")
 }
 
 TEST_CASE("quick")
+{
+	const sortvis::SorterAlgorithm algorithms[]{sortvis::algorithms::quick, sortvis::algorithms::hoareQuick,
+	    sortvis::algorithms::threeWayQuick, sortvis::algorithms::randomQuick};
+
+	constexpr size_t ELEMENTS = 1000;
+	sortvis::SortableCollection sorted(ELEMENTS);
+	sortvis::SortableCollection reversed(ELEMENTS);
+	sortvis::SortableCollection fewUnique(ELEMENTS);
+	sortvis::SortableCollection equal(ELEMENTS);
+	sortvis::SortableCollection random(ELEMENTS);
+	random.randomize(4711);
+	for(size_t i = 0; i < ELEMENTS; ++i)
+	{
+		sorted.write(i, static_cast<int>(i));
+		reversed.write(i, static_cast<int>(ELEMENTS - i));
+		fewUnique.write(i, random.values()[i] % 4);
+		equal.write(i, 7);
+	}
+
+	const auto compares = [](const sortvis::SortableCollection& sortables, sortvis::SorterAlgorithm algorithm)
+	{
+		sortvis::Sorter sorter(sortables, algorithm);
+		while(sorter.advance()) {}
+		return sorter.data().getCounter(sortvis::Sortable::AccessState::Read);
+	};
+
+	for(sortvis::SorterAlgorithm algorithm : algorithms)
+	{
+		for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+		{
+			sortvis::Sorter asc(*sc_ptr, algorithm);
+
+			while(asc.advance()) {}
+
+			CHECK(asc.data() == SC_ASC);
+			CHECK(asc.data().getCounter(sortvis::Sortable::SortState::Full) == sc_ptr->size());
+		}
+
+		for(const sortvis::SortableCollection* input : {&sorted, &reversed, &fewUnique, &equal, &random})
+		{
+			sortvis::Sorter direct(*input, algorithm);
+			while(direct.advance()) {}
+
+			CHECK(std::is_sorted(direct.data().values().begin(), direct.data().values().end()));
+			CHECK(direct.data().getCounter(sortvis::Sortable::SortState::Full) == ELEMENTS);
+
+			std::vector<int> values(input->values().begin(), input->values().end());
+			sortvis::getNativeAlgorithm(algorithm)(values);
+			CHECK(std::equal(values.begin(), values.end(), direct.data().values().begin(),
+			    direct.data().values().end()));
+		}
+
+		if(algorithm != sortvis::algorithms::quick)
+		{
+			// unlike the last element as pivot none of them goes quadratic on these
+			CHECK(compares(sorted, algorithm) * 20 < compares(sorted, sortvis::algorithms::quick));
+			CHECK(compares(reversed, algorithm) * 20 < compares(reversed, sortvis::algorithms::quick));
+			CHECK(compares(equal, algorithm) * 20 < compares(equal, sortvis::algorithms::quick));
+		}
+	}
+
+	// equal elements are finished in a single pass
+	CHECK(compares(equal, sortvis::algorithms::threeWayQuick) < 3 * ELEMENTS);
+	CHECK(compares(fewUnique, sortvis::algorithms::threeWayQuick) < 10 * ELEMENTS);
+
+	// median pivots keep large sorted & reversed inputs linearithmic
+	for(sortvis::NativeAlgorithm native : {sortvis::algorithms::native::hoareQuick,
+	        sortvis::algorithms::native::threeWayQuick})
+	{
+		std::vector<int> large(200'000);
+		std::iota(large.begin(), large.end(), 0);
+		native(large);
+		CHECK(std::is_sorted(large.begin(), large.end()));
+
+		std::reverse(large.begin(), large.end());
+		native(large);
+		CHECK(std::is_sorted(large.begin(), large.end()));
+	}
+}
+
+TEST_CASE("heap")
 {
 	for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
 	{
-		sortvis::Sorter asc(*sc_ptr, sortvis::algorithms::quick);
+		sortvis::Sorter asc(*sc_ptr, sortvis::algorithms::heap);
 
 		while(asc.advance()) {}
 
@@ -87,14 +226,290 @@ TEST_CASE("quick")
 	}
 }
 
-TEST_CASE("heap")
+TEST_CASE("bitonic")
 {
 	for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
 	{
-		sortvis::Sorter asc(*sc_ptr, sortvis::algorithms::heap);
+		sortvis::Sorter asc(*sc_ptr, sortvis::algorithms::bitonic);
 
 		while(asc.advance()) {}
 
 		CHECK(asc.data() == SC_ASC);
 	}
+
+	sortvis::SortableCollection large(1000);
+	large.randomize(4711);
+	const sortvis::SortableCollection sorted = checkTracedReplay(large, sortvis::algorithms::bitonic);
+
+	CHECK(sorted.getVectorOps() > 0);
+	CHECK(sorted.getPeakAuxBytes() == large.size() * sizeof(int));
+	CHECK(sorted.getWrites() > 0);
+}
+
+TEST_CASE("radix")
+{
+	const sortvis::SorterAlgorithm algorithms[]{sortvis::algorithms::lsdRadix, sortvis::algorithms::msdRadix};
+
+	const sortvis::SortableCollection negative{
+	    -3, 700, -70000, 5, 0, -1, 2'000'000'000, -2'000'000'000, 5, -3, 64, 300, -300, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+	    -11, 12, -13, 14, 15, -16, 17, 18, 19, 20, 21, 22, 23, 24, 25};
+	std::vector<int> expected(negative.values().begin(), negative.values().end());
+	std::sort(expected.begin(), expected.end());
+
+	sortvis::SortableCollection large(1000);
+	large.randomize(4711);
+
+	for(sortvis::SorterAlgorithm algorithm : algorithms)
+	{
+		for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+		{
+			sortvis::Sorter asc(*sc_ptr, algorithm);
+
+			while(asc.advance()) {}
+
+			CHECK(asc.data() == SC_ASC);
+		}
+
+		sortvis::Sorter signedKeys(negative, algorithm);
+
+		while(signedKeys.advance()) {}
+
+		CHECK(std::equal(expected.begin(), expected.end(), signedKeys.data().values().begin(),
+		    signedKeys.data().values().end()));
+		CHECK(signedKeys.data().getCounter(sortvis::Sortable::SortState::Full) == negative.size());
+
+		CHECK(checkTracedReplay(large, algorithm).getWrites() > 0);
+
+		sortvis::NativeAlgorithm native = sortvis::getNativeAlgorithm(algorithm);
+		REQUIRE(native != nullptr);
+		std::vector<int> values(negative.values().begin(), negative.values().end());
+		native(values);
+		CHECK(values == expected);
+	}
+
+	// keys only differ in their most and least significant digit, both sorts distribute exactly these two digits
+	std::vector<int> sparse(1024);
+	for(size_t i = 0; i < sparse.size(); ++i)
+	{
+		sparse[i] = static_cast<int>((i % 4) << 24 | (sparse.size() - 1 - i) % 256);
+	}
+	const sortvis::SortableCollection sparseKeys{std::span<const int>(sparse)};
+
+	sortvis::Sorter lsd(sparseKeys, sortvis::algorithms::lsdRadix);
+	sortvis::Sorter msd(sparseKeys, sortvis::algorithms::msdRadix);
+
+	while(lsd.advance()) {}
+	while(msd.advance()) {}
+
+	CHECK(std::is_sorted(msd.data().values().begin(), msd.data().values().end()));
+	CHECK(msd.data().getCounter(sortvis::Sortable::SortState::Full) == sparse.size());
+	CHECK(lsd.data().getWrites() == 2 * sparse.size());
+	CHECK(msd.data().getWrites() == 4 * sparse.size());
+}
+
+TEST_CASE("merge")
+{
+	const sortvis::SorterAlgorithm algorithms[]{
+	    sortvis::algorithms::topDownMerge, sortvis::algorithms::bottomUpMerge, sortvis::algorithms::naturalMerge};
+
+	sortvis::SortableCollection large(1001);
+	large.randomize(4711);
+
+	for(sortvis::SorterAlgorithm algorithm : algorithms)
+	{
+		for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+		{
+			sortvis::Sorter asc(*sc_ptr, algorithm);
+
+			while(asc.advance()) {}
+
+			CHECK(asc.data() == SC_ASC);
+			CHECK(asc.data().getCounter(sortvis::Sortable::SortState::Full) == sc_ptr->size());
+		}
+
+		checkTracedReplay(large, algorithm);
+	}
+
+	const auto peakAuxBytes = [](const sortvis::SortableCollection& sortables, sortvis::SorterAlgorithm algorithm)
+	{
+		sortvis::Sorter sorter(sortables, algorithm);
+		while(sorter.advance()) {}
+		return sorter.data().getPeakAuxBytes();
+	};
+
+	CHECK(peakAuxBytes(large, sortvis::algorithms::topDownMerge) == large.size() / 2 * sizeof(int));
+	CHECK(peakAuxBytes(large, sortvis::algorithms::bottomUpMerge) == large.size() * sizeof(int));
+	CHECK(peakAuxBytes(large, sortvis::algorithms::naturalMerge) == large.size() * sizeof(int));
+	CHECK(peakAuxBytes(SC_ASC, sortvis::algorithms::naturalMerge) == 0);
+	CHECK(peakAuxBytes(SC_DSC, sortvis::algorithms::naturalMerge) == 0);
+}
+
+TEST_CASE("hybrid")
+{
+	const sortvis::SorterAlgorithm algorithms[]{
+	    sortvis::algorithms::intro, sortvis::algorithms::pdq, sortvis::algorithms::tim};
+
+	constexpr size_t ELEMENTS = 1000;
+	sortvis::SortableCollection sorted(ELEMENTS);
+	sortvis::SortableCollection reversed(ELEMENTS);
+	sortvis::SortableCollection fewUnique(ELEMENTS);
+	sortvis::SortableCollection random(ELEMENTS);
+	random.randomize(4711);
+	for(size_t i = 0; i < ELEMENTS; ++i)
+	{
+		sorted.write(i, static_cast<int>(i));
+		reversed.write(i, static_cast<int>(ELEMENTS - i));
+		fewUnique.write(i, random.values()[i] % 4);
+	}
+
+	const auto compares = [](const sortvis::SortableCollection& sortables, sortvis::SorterAlgorithm algorithm)
+	{
+		sortvis::Sorter sorter(sortables, algorithm);
+		while(sorter.advance()) {}
+		return sorter.data().getCounter(sortvis::Sortable::AccessState::Read);
+	};
+
+	for(sortvis::SorterAlgorithm algorithm : algorithms)
+	{
+		for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+		{
+			sortvis::Sorter asc(*sc_ptr, algorithm);
+
+			while(asc.advance()) {}
+
+			CHECK(asc.data() == SC_ASC);
+			CHECK(asc.data().getCounter(sortvis::Sortable::SortState::Full) == sc_ptr->size());
+		}
+
+		for(const sortvis::SortableCollection* input : {&sorted, &reversed, &fewUnique, &random})
+		{
+			const sortvis::SortableCollection sortedInput = checkTracedReplay(*input, algorithm);
+
+			std::vector<int> values(input->values().begin(), input->values().end());
+			sortvis::getNativeAlgorithm(algorithm)(values);
+			CHECK(std::equal(values.begin(), values.end(), sortedInput.values().begin(), sortedInput.values().end()));
+		}
+
+		// unlike quick none of them goes quadratic on sorted or few unique input
+		CHECK(compares(sorted, algorithm) * 20 < compares(sorted, sortvis::algorithms::quick));
+		CHECK(compares(fewUnique, algorithm) * 4 < compares(fewUnique, sortvis::algorithms::quick));
+
+		// defeats pdq's pattern breaking, so it falls back to heap sort next to an already placed pivot
+		sortvis::SortableCollection organPipe(3000);
+		organPipe.generate(sortvis::Distribution::OrganPipe, 1);
+		sortvis::Sorter adversarial(organPipe, algorithm);
+
+		while(adversarial.advance()) {}
+
+		CHECK(std::is_sorted(adversarial.data().values().begin(), adversarial.data().values().end()));
+		CHECK(adversarial.data().getCounter(sortvis::Sortable::SortState::Full) == organPipe.size());
+		CHECK(adversarial.data().getCounter(sortvis::Sortable::SortState::None) == 0);
+	}
+
+	CHECK(compares(sorted, sortvis::algorithms::tim) == ELEMENTS - 1);
+	CHECK(compares(reversed, sortvis::algorithms::tim) == ELEMENTS - 1);
+	CHECK(compares(sorted, sortvis::algorithms::pdq) < 4 * ELEMENTS);
+	CHECK(compares(reversed, sortvis::algorithms::pdq) < 4 * ELEMENTS);
+
+	sortvis::Sorter tim(random, sortvis::algorithms::tim);
+	while(tim.advance()) {}
+	CHECK(tim.data().getPeakAuxBytes() <= ELEMENTS / 2 * sizeof(int));
+}
+
+TEST_CASE("native bitonic")
+{
+	std::mt19937 rng(4711);
+	std::uniform_int_distribution<int> any(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+	std::uniform_int_distribution<int> few(-8, 8);
+
+	for(bool vector : {true, false})
+	{
+		sortvis::algorithms::setVectorKernels(vector);
+
+		for(size_t elements : std::initializer_list<size_t>{0, 1, 7, 8, 63, 64, 65, 200, 1000, 4097})
+		{
+			for(auto* distribution : {&any, &few})
+			{
+				std::vector<int> values(elements);
+				std::generate(values.begin(), values.end(),
+				    [&]
+				    {
+					    return (*distribution)(rng);
+				    });
+				if(!values.empty())
+				{
+					values.front() = std::numeric_limits<int>::max();
+				}
+				std::vector<int> expected = values;
+				std::sort(expected.begin(), expected.end());
+
+				sortvis::algorithms::native::bitonic(values);
+
+				CHECK(values == expected);
+			}
+		}
+	}
+	sortvis::algorithms::setVectorKernels(true);
+}
+
+TEST_CASE("native")
+{
+	const sortvis::SorterAlgorithm algorithms[]{sortvis::algorithms::bubble, sortvis::algorithms::insertion,
+	    sortvis::algorithms::hoareQuick, sortvis::algorithms::threeWayQuick, sortvis::algorithms::randomQuick,
+	    sortvis::algorithms::shell, sortvis::algorithms::tokudaShell, sortvis::algorithms::sedgewickShell,
+	    sortvis::algorithms::selection, sortvis::algorithms::quick, sortvis::algorithms::heap,
+	    sortvis::algorithms::bitonic, sortvis::algorithms::lsdRadix, sortvis::algorithms::msdRadix,
+	    sortvis::algorithms::topDownMerge, sortvis::algorithms::bottomUpMerge, sortvis::algorithms::naturalMerge,
+	    sortvis::algorithms::intro, sortvis::algorithms::pdq, sortvis::algorithms::tim};
+
+	for(sortvis::SorterAlgorithm algorithm : algorithms)
+	{
+		sortvis::NativeAlgorithm native = sortvis::getNativeAlgorithm(algorithm);
+		REQUIRE(native != nullptr);
+
+		for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+		{
+			std::vector<int> values(sc_ptr->values().begin(), sc_ptr->values().end());
+
+			native(values);
+
+			CHECK(std::equal(values.begin(), values.end(), SC_ASC.values().begin(), SC_ASC.values().end()));
+		}
+	}
+}
+
+TEST_CASE("parallel")
+{
+	const sortvis::SorterAlgorithm algorithms[]{
+	    sortvis::algorithms::parallelMerge, sortvis::algorithms::parallelSample};
+
+	sortvis::SortableCollection large(1000);
+	large.randomize(4711);
+
+	for(sortvis::SorterAlgorithm algorithm : algorithms)
+	{
+		for(size_t lanes : {size_t(1), size_t(3), size_t(4)})
+		{
+			sortvis::algorithms::setParallelLanes(lanes);
+			sortvis::algorithms::setParallelBatch(lanes == 3 ? 1 : sortvis::algorithms::DEFAULT_PARALLEL_BATCH);
+
+			for(const sortvis::SortableCollection* sc_ptr : SC_ARR)
+			{
+				sortvis::Sorter asc(*sc_ptr, algorithm);
+
+				while(asc.advance()) {}
+
+				CHECK(asc.data() == SC_ASC);
+			}
+
+			sortvis::Sorter sorter(large, algorithm);
+
+			while(sorter.advance()) {}
+
+			CHECK(std::is_sorted(sorter.data().values().begin(), sorter.data().values().end()));
+			CHECK(sorter.data().getCounter(sortvis::Sortable::SortState::Full) == large.size());
+		}
+	}
+	sortvis::algorithms::setParallelLanes(0);
+	sortvis::algorithms::setParallelBatch(sortvis::algorithms::DEFAULT_PARALLEL_BATCH);
 }
@@ -0,0 +1,58 @@
+#include "thread-pool.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+
+TEST_CASE("ThreadPool::run")
+{
+	sortvis::ThreadPool pool(3);
+
+	REQUIRE(pool.size() == 3);
+
+	std::vector<size_t> calls(100, 0);
+
+	for(size_t batch = 0; batch < 10; ++batch)
+	{
+		pool.run(calls.size(),
+		    [&calls](size_t idx)
+		    {
+			    ++calls[idx];
+		    });
+	}
+
+	CHECK(std::all_of(calls.begin(), calls.end(),
+	    [](size_t count)
+	    {
+		    return count == 10;
+	    }));
+
+	CHECK_THROWS_AS(pool.run(8,
+	                    [](size_t idx)
+	                    {
+		                    if(idx == 5)
+		                    {
+			                    throw std::runtime_error("task failed");
+		                    }
+	                    }),
+	    std::runtime_error);
+
+	pool.run(calls.size(),
+	    [&calls](size_t idx)
+	    {
+		    --calls[idx];
+	    });
+
+	CHECK(calls.front() == 9);
+	CHECK(calls.back() == 9);
+
+	std::atomic<size_t> inside{0};
+	pool.run(calls.size(),
+	    [&inside](size_t)
+	    {
+		    inside += static_cast<size_t>(sortvis::ThreadPool::insideTask());
+	    });
+	CHECK(inside == calls.size());
+	CHECK_FALSE(sortvis::ThreadPool::insideTask());
+}
@@ -0,0 +1,70 @@
+#include "sortable.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("OperationTrace::endStep")
+{
+	sortvis::OperationTrace trace;
+
+	trace.push({sortvis::Operation::Type::Compare, 0, 1, 2});
+	trace.push({sortvis::Operation::Type::Swap, 0, 1, 2});
+
+	CHECK(trace.size() == 0);
+
+	trace.endStep(false);
+
+	REQUIRE(trace.size() == 3);
+	CHECK(trace.chunk(0)[0].type == sortvis::Operation::Type::Compare);
+	CHECK(trace.chunk(0)[1].type == sortvis::Operation::Type::Swap);
+	CHECK(trace.chunk(0)[2].type == sortvis::Operation::Type::Step);
+
+	for(size_t i = 0; i < sortvis::OperationTrace::CHUNK_SIZE; ++i)
+	{
+		trace.push({sortvis::Operation::Type::Compare, 0, 0, 1});
+	}
+	trace.endStep(true);
+
+	REQUIRE(trace.size() == sortvis::OperationTrace::CHUNK_SIZE + 4);
+	CHECK(trace.chunk(1)[3].type == sortvis::Operation::Type::Finish);
+
+	trace.release(sortvis::OperationTrace::CHUNK_SIZE - 1);
+	CHECK(trace.heldChunks() == 2);
+	trace.release(sortvis::OperationTrace::CHUNK_SIZE + 1);
+	CHECK(trace.heldChunks() == 1);
+	CHECK(trace.chunk(1)[3].type == sortvis::Operation::Type::Finish);
+}
+
+TEST_CASE("SortableCollection::attach")
+{
+	sortvis::SortableCollection recorded({6, 5, 4, 3, 2, 1});
+	sortvis::SortableCollection replayed(recorded);
+	sortvis::OperationTrace trace;
+
+	recorded.attach(&trace);
+
+	const sortvis::SortableCollection copy(recorded);
+
+	recorded.less(0, 1);
+	recorded.swap(2, 3);
+	recorded.state(sortvis::Sortable::AccessState::None, 0U, 1U);
+	recorded.state(sortvis::Sortable::SortState::Full, 5U);
+	trace.endStep(true);
+
+	REQUIRE(trace.size() == 6);
+
+	for(size_t i = 0; i < trace.size(); ++i)
+	{
+		replayed.apply(trace.chunk(0)[i]);
+	}
+
+	CHECK(replayed == recorded);
+	CHECK(replayed.getCounter(sortvis::Sortable::AccessState::Read) == 1);
+	CHECK(replayed.getCounter(sortvis::Sortable::AccessState::Write) == 1);
+	CHECK(replayed.getCounter(sortvis::Sortable::SortState::Full) == 1);
+	for(size_t i = 0; i < replayed.size(); ++i)
+	{
+		CHECK(replayed[i] == recorded[i].accessState);
+		CHECK(replayed[i] == recorded[i].sortState);
+	}
+	CHECK(copy != recorded);
+}